@@ -0,0 +1,533 @@
+/**
+ * @file  Address.cpp
+ * @brief Address
+ *
+ * Class implementation for Address
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <netinet/in.h>
+#include <string_view>
+#include <sys/socket.h>
+#include <vector>
+#include "Address.hpp"
+
+namespace {
+  // One row of a special-purpose registry, with the mask precomputed
+  struct Special {
+    std::uint8_t  network[16];
+    std::uint8_t  mask[16];
+    std::uint32_t properties;
+  };
+
+  // Builds a registry row from a network prefix written as bytes
+  constexpr Special special(std::initializer_list<std::uint8_t> network,
+      unsigned length, std::uint32_t properties) {
+    Special result{{}, {}, properties};
+    std::size_t i = 0;
+    for (std::uint8_t byte : network)
+      result.network[i++] = byte;
+    for (i = 0; i < 16; i++) {
+      const unsigned keep = length > i * 8 ?
+        (length - i * 8 < 8 ? length - i * 8 : 8) : 0;
+      result.mask[i] = static_cast<std::uint8_t>(0xff00 >> keep);
+      result.network[i] &= result.mask[i];
+    }
+    return result;
+  }
+
+  // IANA IPv4 Special-Purpose Address Registry (plus multicast and limited
+  // broadcast, which live in their own registries)
+  constexpr Special specials4[] = {
+    special({0},              8, Address::Reserved),
+    special({0, 0, 0, 0},    32, Address::Unspecified),
+    special({10},             8, Address::Private),
+    special({100, 64},       10, Address::Shared),
+    special({127},            8, Address::Loopback),
+    special({169, 254},      16, Address::LinkLocal),
+    special({172, 16},       12, Address::Private),
+    special({192, 0, 0},     24, Address::Reserved),
+    special({192, 0, 2},     24, Address::Documentation),
+    special({192, 88, 99},   24, Address::Reserved | Address::Tunnel),
+    special({192, 168},      16, Address::Private),
+    special({198, 18},       15, Address::Benchmarking),
+    special({198, 51, 100},  24, Address::Documentation),
+    special({203, 0, 113},   24, Address::Documentation),
+    special({224},            4, Address::Multicast),
+    special({240},            4, Address::Reserved),
+    special({255, 255, 255, 255}, 32, Address::Broadcast)
+  };
+
+  // IANA IPv6 Special-Purpose Address Registry (plus multicast)
+  constexpr Special specials6[] = {
+    special({},                                      128,
+      Address::Unspecified),
+    special({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}, 128,
+      Address::Loopback),
+    special({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff}, 96,
+      Address::Mapped),
+    special({0x00, 0x64, 0xff, 0x9b},                 96,
+      Address::Translation),
+    special({0x00, 0x64, 0xff, 0x9b, 0x00, 0x01},     48,
+      Address::Translation),
+    special({0x01},                                   64,
+      Address::Reserved),
+    special({0x20, 0x01},                             32,
+      Address::Tunnel),
+    special({0x20, 0x01, 0x00, 0x02},                 48,
+      Address::Benchmarking),
+    special({0x20, 0x01, 0x0d, 0xb8},                 32,
+      Address::Documentation),
+    special({0x20, 0x02},                             16,
+      Address::Tunnel),
+    special({0x3f, 0xff},                             20,
+      Address::Documentation),
+    special({0xfc},                                    7,
+      Address::Private),
+    special({0xfe, 0x80},                             10,
+      Address::LinkLocal),
+    special({0xfe, 0xc0},                             10,
+      Address::Reserved),
+    special({0xff},                                    8,
+      Address::Multicast)
+  };
+
+  // Set in a first-byte summary when longer prefixes must also be checked
+  constexpr std::uint32_t refine = 1u << 31;
+
+  // Summarizes a registry by first byte: the properties of every prefix that
+  // covers the whole byte, and whether any longer prefix starts there
+  template <std::size_t N>
+  constexpr std::array<std::uint32_t, 256> summarize(
+      const Special (&specials)[N]) {
+    std::array<std::uint32_t, 256> result{};
+    for (std::size_t b = 0; b < 256; b++)
+      for (const Special& s : specials)
+        if ((b & s.mask[0]) == s.network[0])
+          result[b] |= s.mask[1] == 0 ? s.properties : refine;
+    return result;
+  }
+
+  constexpr std::array<std::uint32_t, 256> summary4 = summarize(specials4);
+  constexpr std::array<std::uint32_t, 256> summary6 = summarize(specials6);
+
+  // Adds the properties of every row matching beyond its first byte
+  template <std::size_t N>
+  std::uint32_t lookup(const Special (&specials)[N],
+      const std::uint8_t* bytes, std::uint32_t properties) {
+    if ((properties & refine) == 0)
+      return properties;
+    properties &= ~refine;
+    for (const Special& s : specials) {
+      if (s.mask[1] == 0 || (bytes[0] & s.mask[0]) != s.network[0])
+        continue;
+      bool match = true;
+      for (std::size_t i = 1; i < 16 && s.mask[i] != 0 && match; i++)
+        match = (bytes[i] & s.mask[i]) == s.network[i];
+      if (match)
+        properties |= s.properties;
+    }
+    return properties;
+  }
+}
+
+/**
+ * @brief Address
+ *
+ * Converts the result of `Utility::parse_addr` (or any IPv4/IPv6 socket
+ * address) into a compact Address
+ *
+ * @param address The `struct sockaddr_storage` to convert
+ */
+Address::Address(const struct sockaddr_storage& address) {
+  if (address.ss_family == AF_INET) {
+    const struct sockaddr_in& in =
+      reinterpret_cast<const struct sockaddr_in&>(address);
+    memcpy(this->bytes, &in.sin_addr, 4);
+    this->port   = ntohs(in.sin_port);
+    this->family = AF_INET;
+  } else if (address.ss_family == AF_INET6) {
+    const struct sockaddr_in6& in6 =
+      reinterpret_cast<const struct sockaddr_in6&>(address);
+    memcpy(this->bytes, &in6.sin6_addr, 16);
+    this->port   = ntohs(in6.sin6_port);
+    this->family = AF_INET6;
+  }
+}
+
+/**
+ * @brief Classify
+ *
+ * Looks up the properties of the address in the IANA special-purpose
+ * registries, such as for SSRF and ACL checks
+ *
+ * @remarks The registries are compiled into per-first-byte summaries, so
+ * most addresses are classified with a single table load; only first bytes
+ * shared with longer prefixes (such as 192, 172 or 0x20) scan the few rows
+ * that start there. IPv4-mapped IPv6 addresses also carry the properties of
+ * the embedded IPv4 address.
+ *
+ * @return A bitmask of `Address::Property` values (zero for ordinary global
+ * unicast addresses and unset families)
+ */
+std::uint32_t Address::classify() const {
+  if (this->family == AF_INET)
+    return lookup(specials4, this->bytes, summary4[this->bytes[0]]);
+  if (this->family != AF_INET6)
+    return 0;
+  std::uint32_t properties = lookup(specials6, this->bytes,
+    summary6[this->bytes[0]]);
+  if (properties & Address::Mapped)
+    properties |= lookup(specials4, this->bytes + 12,
+      summary4[this->bytes[12]]);
+  return properties;
+}
+
+/**
+ * @brief Equality
+ *
+ * Compares the family, address bytes and port of two Address objects
+ *
+ * @param other The Address to compare with
+ *
+ * @return `true` if both are equal, otherwise `false`
+ */
+bool Address::operator==(const Address& other) const {
+  return this->family == other.family && this->port == other.port &&
+    memcmp(this->bytes, other.bytes, sizeof(this->bytes)) == 0;
+}
+
+bool Address::operator!=(const Address& other) const {
+  return !(*this == other);
+}
+
+/**
+ * @brief Format
+ *
+ * Writes the canonical text form of the address (dotted-quad for IPv4, RFC
+ * 5952 for IPv6) without allocating
+ *
+ * @param[out] out Storage for at least INET6_ADDRSTRLEN bytes; the result is
+ *                 not NUL terminated
+ *
+ * @return The number of bytes written (zero when the family is unset)
+ */
+std::size_t Address::format(char* out) const {
+  static const char hex[] = "0123456789abcdef";
+  char* p = out;
+  auto dotted = [&p](const std::uint8_t* b) {
+    for (int i = 0; i < 4; i++) {
+      if (i > 0)
+        *p++ = '.';
+      if (b[i] >= 100)
+        *p++ = static_cast<char>('0' + b[i] / 100);
+      if (b[i] >= 10)
+        *p++ = static_cast<char>('0' + b[i] / 10 % 10);
+      *p++ = static_cast<char>('0' + b[i] % 10);
+    }
+  };
+
+  if (this->family == AF_INET) {
+    dotted(this->bytes);
+    return static_cast<std::size_t>(p - out);
+  }
+  if (this->family != AF_INET6)
+    return 0;
+
+  unsigned groups[8];
+  for (int i = 0; i < 8; i++)
+    groups[i] = static_cast<unsigned>(this->bytes[i * 2] << 8 |
+      this->bytes[i * 2 + 1]);
+  // IPv4-mapped addresses keep their embedded dotted-quad
+  bool mapped = groups[0] == 0 && groups[1] == 0 && groups[2] == 0 &&
+    groups[3] == 0 && groups[4] == 0 && groups[5] == 0xffff;
+  int count = mapped ? 6 : 8;
+  // Find the first longest run of two or more zero groups to compress
+  int best = -1, best_length = 1;
+  for (int i = 0; i < count;) {
+    int j = i;
+    while (j < count && groups[j] == 0)
+      j++;
+    if (j - i > best_length)
+      best = i, best_length = j - i;
+    i = j > i ? j : i + 1;
+  }
+  for (int i = 0; i < count; i++) {
+    if (i == best) {
+      *p++ = ':', *p++ = ':';
+      i += best_length - 1;
+      continue;
+    }
+    if (i > 0 && i != best + best_length)
+      *p++ = ':';
+    bool digits = false;
+    for (int shift = 12; shift >= 0; shift -= 4) {
+      unsigned d = groups[i] >> shift & 0xf;
+      if (d != 0 || digits || shift == 0)
+        *p++ = hex[d], digits = true;
+    }
+  }
+  if (mapped) {
+    if (best + best_length != count)
+      *p++ = ':';
+    dotted(this->bytes + 12);
+  }
+  return static_cast<std::size_t>(p - out);
+}
+
+/**
+ * @brief Length
+ *
+ * Determines the number of meaningful address bytes
+ *
+ * @return 4 for IPv4, 16 for IPv6 and 0 when unset
+ */
+std::size_t Address::length() const {
+  return this->family == AF_INET ? 4 : this->family == AF_INET6 ? 16 : 0;
+}
+
+/**
+ * @brief Socket Address
+ *
+ * Converts the Address into the same form returned by `Utility::parse_addr`,
+ * suitable for use in socket operations
+ *
+ * @return `struct sockaddr_storage` containing the address and port
+ */
+struct sockaddr_storage Address::sockaddr() const {
+  struct sockaddr_storage address = {};
+  if (this->family == AF_INET) {
+    struct sockaddr_in& in = reinterpret_cast<struct sockaddr_in&>(address);
+    in.sin_family = AF_INET;
+    in.sin_port   = htons(this->port);
+    memcpy(&in.sin_addr, this->bytes, 4);
+  } else if (this->family == AF_INET6) {
+    struct sockaddr_in6& in6 =
+      reinterpret_cast<struct sockaddr_in6&>(address);
+    in6.sin6_family = AF_INET6;
+    in6.sin6_port   = htons(this->port);
+    memcpy(&in6.sin6_addr, this->bytes, 16);
+  }
+  return address;
+}
+
+/**
+ * @brief Parse
+ *
+ * Parses a numeric IPv4 or IPv6 address without allocating, resolving or
+ * throwing
+ *
+ * @remarks Unlike `Utility::parse_addr`, only the strict dotted-quad IPv4
+ * form and IPv6 without a zone index are accepted. The port is left as zero.
+ *
+ * @param      s   The text to parse
+ * @param[out] out Storage for the parsed Address
+ *
+ * @return `true` on success, otherwise `false`
+ */
+bool Address::parse(std::string_view s, Address& out) {
+  out = Address{};
+  if (s.find(':') != std::string_view::npos) {
+    if (!Address::parse6(s, out.bytes))
+      return false;
+    out.family = AF_INET6;
+  } else {
+    if (!Address::parse4(s, out.bytes))
+      return false;
+    out.family = AF_INET;
+  }
+  return true;
+}
+
+/**
+ * @brief Parse IPv4
+ *
+ * Parses a dotted-quad IPv4 address of four decimal octets without leading
+ * zeros
+ *
+ * @param      s   The text to parse
+ * @param[out] out Storage for the four network order address bytes
+ *
+ * @return `true` on success, otherwise `false`
+ */
+bool Address::parse4(std::string_view s, std::uint8_t* out) {
+  std::size_t i = 0;
+  for (int octet = 0; octet < 4; octet++) {
+    if (octet > 0 && (i >= s.length() || s[i++] != '.'))
+      return false;
+    unsigned value = 0;
+    std::size_t start = i;
+    for (; i < s.length() && i - start < 3 && s[i] >= '0' && s[i] <= '9'; i++)
+      value = value * 10 + static_cast<unsigned>(s[i] - '0');
+    if (i == start || value > 255 || (i - start > 1 && s[start] == '0'))
+      return false;
+    out[octet] = static_cast<std::uint8_t>(value);
+  }
+  return i == s.length();
+}
+
+/**
+ * @brief Parse IPv6
+ *
+ * Parses an IPv6 address of up to eight hexadecimal groups, with at most one
+ * `::` and an optional trailing dotted-quad IPv4 address
+ *
+ * @param      s   The text to parse
+ * @param[out] out Storage for the sixteen network order address bytes
+ *
+ * @return `true` on success, otherwise `false`
+ */
+bool Address::parse6(std::string_view s, std::uint8_t* out) {
+  std::uint8_t groups[16] = {};
+  std::size_t  n = 0, i = 0;
+  long         gap = -1;
+
+  if (s.substr(0, 2) == "::")
+    gap = 0, i = 2;
+  while (i < s.length()) {
+    // A group containing a dot is a trailing IPv4 address
+    std::size_t next = s.find(':', i);
+    std::string_view group = s.substr(i, next == std::string_view::npos ?
+      std::string_view::npos : next - i);
+    if (next == std::string_view::npos &&
+        group.find('.') != std::string_view::npos) {
+      if (n > 12 || !Address::parse4(group, groups + n))
+        return false;
+      n += 4;
+      break;
+    }
+    unsigned value = 0;
+    std::size_t digits = 0;
+    for (; digits < group.length(); digits++) {
+      char c = group[digits];
+      unsigned d = c >= '0' && c <= '9' ? c - '0' :
+        c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+        c >= 'A' && c <= 'F' ? c - 'A' + 10 : 16;
+      if (d > 15)
+        return false;
+      value = value << 4 | d;
+    }
+    if (digits == 0 || digits > 4 || n == 16)
+      return false;
+    groups[n++] = static_cast<std::uint8_t>(value >> 8);
+    groups[n++] = static_cast<std::uint8_t>(value);
+    if (next == std::string_view::npos)
+      break;
+    i = next + 1;
+    if (i < s.length() && s[i] == ':') {
+      // Only one `::` is permitted
+      if (gap >= 0)
+        return false;
+      gap = static_cast<long>(n), i++;
+    } else if (i == s.length())
+      return false;
+  }
+
+  if (gap < 0 ? n != 16 : n > 14)
+    return false;
+  // Expand the `::` by moving the trailing groups to the end
+  std::size_t head = gap < 0 ? n : static_cast<std::size_t>(gap);
+  memset(out, 0, 16);
+  memcpy(out, groups, head);
+  memcpy(out + 16 - (n - head), groups + head, n - head);
+  return true;
+}
+
+/**
+ * @brief Parse Endpoints
+ *
+ * Parses a comma separated list of endpoints such as
+ * `10.0.0.1:80,10.0.0.2:80,[fe80::1]:443` in a single pass, appending one
+ * record with its own status per entry instead of throwing
+ *
+ * @remarks Entries are trimmed of whitespace. IPv6 addresses with a port must
+ * be enclosed in brackets; entries without a port receive `default_port`.
+ *
+ * @param      list         The endpoint list to parse
+ * @param[out] out          The std::vector to append records to
+ * @param      default_port Port assigned to entries that do not specify one
+ *
+ * @return The number of entries parsed successfully
+ */
+std::size_t Address::parse_endpoints(std::string_view list,
+    std::vector<Endpoint>& out, std::uint16_t default_port) {
+  std::size_t ok = 0;
+  if (list.find_first_not_of(" \t\r\n") == std::string_view::npos)
+    return ok;
+  out.reserve(out.size() + 1 + static_cast<std::size_t>(
+    std::count(list.begin(), list.end(), ',')));
+
+  for (std::size_t lpos = 0; lpos <= list.length();) {
+    std::size_t cpos = list.find(',', lpos);
+    if (cpos == std::string_view::npos)
+      cpos = list.length();
+    std::string_view entry = list.substr(lpos, cpos - lpos);
+    lpos = cpos + 1;
+
+    // Trim the entry
+    std::size_t first = entry.find_first_not_of(" \t\r\n");
+    Endpoint& endpoint = out.emplace_back();
+    if (first == std::string_view::npos) {
+      endpoint.status = Status::Empty;
+      continue;
+    }
+    entry = entry.substr(first, entry.find_last_not_of(" \t\r\n") + 1 -
+      first);
+
+    // Separate the host from the port
+    std::string_view host = entry, port;
+    if (entry.front() == '[') {
+      std::size_t close = entry.find(']');
+      if (close == std::string_view::npos || (close + 1 < entry.length() &&
+          entry[close + 1] != ':')) {
+        endpoint.status = Status::BadAddress;
+        continue;
+      }
+      host = entry.substr(1, close - 1);
+      if (close + 1 < entry.length() &&
+          (port = entry.substr(close + 2)).length() == 0) {
+        endpoint.status = Status::BadPort;
+        continue;
+      }
+    } else {
+      std::size_t colon = entry.find(':');
+      // A single colon separates the port; more than one means bare IPv6
+      if (colon != std::string_view::npos &&
+          entry.find(':', colon + 1) == std::string_view::npos) {
+        host = entry.substr(0, colon), port = entry.substr(colon + 1);
+        if (port.length() == 0) {
+          endpoint.status = Status::BadPort;
+          continue;
+        }
+      }
+    }
+
+    if (!Address::parse(host, endpoint.address) ||
+        (entry.front() == '[' && endpoint.address.family != AF_INET6)) {
+      endpoint.address = Address{};
+      endpoint.status = Status::BadAddress;
+      continue;
+    }
+    std::uint32_t number = port.length() > 0 ? 0 : default_port;
+    bool valid = port.length() <= 5;
+    for (std::size_t i = 0; valid && i < port.length(); i++)
+      valid = port[i] >= '0' && port[i] <= '9' &&
+        (number = number * 10 + (port[i] - '0')) <= 65535;
+    if (!valid) {
+      endpoint.address = Address{};
+      endpoint.status = Status::BadPort;
+      continue;
+    }
+    endpoint.address.port = static_cast<std::uint16_t>(number);
+    ok++;
+  }
+  return ok;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file  Address.hpp
+ * @brief Address
+ *
+ * Class definition for Address
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _ADDRESS_HPP
+#define _ADDRESS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <netinet/in.h>
+#include <string_view>
+#include <sys/socket.h>
+#include <vector>
+
+class Address {
+  public:
+    enum class Status : std::uint8_t { Ok, Empty, BadAddress, BadPort };
+    // Properties from the IANA IPv4 and IPv6 special-purpose registries
+    enum Property : std::uint32_t {
+      Unspecified   = 1 << 0,
+      Loopback      = 1 << 1,
+      Private       = 1 << 2,
+      LinkLocal     = 1 << 3,
+      Shared        = 1 << 4,
+      Documentation = 1 << 5,
+      Benchmarking  = 1 << 6,
+      Multicast     = 1 << 7,
+      Broadcast     = 1 << 8,
+      Reserved      = 1 << 9,
+      Mapped        = 1 << 10,
+      Translation   = 1 << 11,
+      Tunnel        = 1 << 12,
+      // Addresses that should never be reached from the public Internet
+      Bogon         = Unspecified | Loopback | Private | LinkLocal | Shared |
+                      Documentation | Benchmarking | Broadcast | Reserved
+    };
+    struct Endpoint;
+
+    // Network order address bytes (only the first four are used for IPv4)
+    std::uint8_t  bytes[16] = {};
+    // Host order port number
+    std::uint16_t port      = 0;
+    // AF_INET, AF_INET6 or zero when unset
+    std::uint8_t  family    = 0;
+
+    Address() {}
+    Address(const struct sockaddr_storage& address);
+    bool operator==(const Address& other) const;
+    bool operator!=(const Address& other) const;
+    std::uint32_t classify() const;
+    std::size_t format(char* out) const;
+    std::size_t length() const;
+    struct sockaddr_storage sockaddr() const;
+
+    static bool parse(std::string_view s, Address& out);
+    static bool parse4(std::string_view s, std::uint8_t* out);
+    static bool parse6(std::string_view s, std::uint8_t* out);
+    static std::size_t parse_endpoints(std::string_view list,
+      std::vector<Endpoint>& out, std::uint16_t default_port = 0);
+};
+
+struct Address::Endpoint {
+  Address         address;
+  Address::Status status = Address::Status::Ok;
+};
+
+#endif
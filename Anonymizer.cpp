@@ -0,0 +1,235 @@
+/**
+ * @file  Anonymizer.cpp
+ * @brief Anonymizer
+ *
+ * Class implementation for Anonymizer
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "Address.hpp"
+#include "Anonymizer.hpp"
+#include "Prefix.hpp"
+
+namespace {
+  // Bytes that may appear in the text form of an address
+  bool candidate(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+      (c >= 'A' && c <= 'F') || c == ':' || c == '.';
+  }
+
+  // Bytes that join an address to a surrounding word
+  bool word(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+      (c >= 'A' && c <= 'Z') || c == '_';
+  }
+
+  // Finds the next run of candidate bytes ending at a word boundary that
+  // contains at least one separator, starting at `i`; returns false when
+  // there is none
+  bool next(std::string_view s, std::size_t& i, std::size_t& start,
+      std::size_t& end) {
+    const std::size_t n = s.length();
+    while (i < n) {
+      if (!candidate(s[i])) {
+        i++;
+        continue;
+      }
+      start = i;
+      bool separator = false;
+      while (i < n && candidate(s[i]))
+        separator |= s[i] == ':' || s[i] == '.', i++;
+      end = i;
+      if (separator && (end == n || !word(s[end])))
+        return true;
+    }
+    return false;
+  }
+}
+
+/**
+ * @brief Anonymizer
+ *
+ * Prepares an anonymizer that truncates addresses to the given prefix
+ * lengths, clearing all host bits beyond them
+ *
+ * @param prefix4 The number of IPv4 bits to keep (default /24)
+ * @param prefix6 The number of IPv6 bits to keep (default /48)
+ */
+Anonymizer::Anonymizer(std::uint8_t prefix4, std::uint8_t prefix6):
+  prefix4{prefix4}, prefix6{prefix6} {}
+
+/**
+ * @brief Match
+ *
+ * Finds the address at the start of a candidate run, allowing for trailing
+ * punctuation (as in "from 10.0.0.1.") and an IPv4 port suffix (as in
+ * "10.0.0.1:80"), and truncates it (IPv4-mapped IPv6 addresses by the IPv4
+ * prefix length)
+ *
+ * @param      run    The candidate run
+ * @param[out] length The length of the address text within `run`
+ * @param[out] masked The truncated address
+ *
+ * @return `true` if the run starts with an address
+ */
+bool Anonymizer::match(std::string_view run, std::size_t& length,
+    Address& masked) const {
+  Address address;
+  // Sentence punctuation is only stripped when the whole run is not an
+  // address, as an IPv6 address may itself end in "::"
+  bool found = Address::parse(run, address);
+  while (!found && !run.empty() && (run.back() == '.' || run.back() == ':')) {
+    run.remove_suffix(1);
+    found = Address::parse(run, address);
+  }
+  if (!found) {
+    const std::size_t colon = run.find(':');
+    if (colon != std::string_view::npos && colon == run.rfind(':') &&
+        run.substr(0, colon).find('.') != std::string_view::npos) {
+      run = run.substr(0, colon);
+      found = Address::parse(run, address);
+    }
+  }
+  if (!found)
+    return false;
+  length = run.length();
+  // IPv4-mapped addresses are masked as the IPv4 address they embed
+  static const std::uint8_t mapped[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0xff, 0xff};
+  std::uint8_t bits = this->prefix6;
+  if (address.family == AF_INET)
+    bits = this->prefix4;
+  else if (memcmp(address.bytes, mapped, sizeof(mapped)) == 0)
+    bits = static_cast<std::uint8_t>(96 + std::min<unsigned>(
+      this->prefix4, 32));
+  masked = Prefix{address, bits}.address;
+  return true;
+}
+
+/**
+ * @brief Find
+ *
+ * Finds the address in a candidate run: the whole run when it starts at a
+ * word boundary, or else the text after its first separator, as in
+ * "client_ip:1.2.3.4", "id:10.0.0.1" or "a.10.0.0.1"
+ *
+ * @remarks A leading label of decimal digits is never skipped, so that runs
+ * such as "1.2.3.4.5" are not partly masked.
+ *
+ * @param         s      The text containing the run
+ * @param[in,out] start  Start of the run, updated to the start of the address
+ * @param         end    End of the run
+ * @param[out]    length The length of the address text
+ * @param[out]    masked The truncated address
+ *
+ * @return `true` if the run contains an address
+ */
+bool Anonymizer::find(std::string_view s, std::size_t& start,
+    std::size_t end, std::size_t& length, Address& masked) const {
+  if ((start == 0 || !word(s[start - 1])) &&
+      this->match(s.substr(start, end - start), length, masked))
+    return true;
+  const std::size_t separator = s.find_first_of(".:", start);
+  if (separator >= end - 1 || (separator > start &&
+      s.substr(start, separator - start).find_first_not_of("0123456789") ==
+      std::string_view::npos))
+    return false;
+  if (!this->match(s.substr(separator + 1, end - separator - 1), length,
+      masked))
+    return false;
+  start = separator + 1;
+  return true;
+}
+
+/**
+ * @brief Anonymize
+ *
+ * Truncates every numeric IPv4 and IPv6 address in a buffer to its
+ * configured prefix, rewriting the buffer in place
+ *
+ * @remarks Addresses are recognized as maximal runs of hexadecimal digits,
+ * colons and dots at word boundaries (or following a `key:` or `label.`
+ * prefix) that parse with `Address::parse`, and are rewritten in canonical
+ * form (RFC 5952 for IPv6). Canonical text of a truncated address is almost
+ * never longer than the original, so the buffer is compacted without
+ * reallocating; should a replacement not fit, the rest of the buffer is
+ * rewritten through a copy instead.
+ *
+ * @param[in,out] buffer The text to anonymize
+ *
+ * @return The number of addresses rewritten
+ */
+std::size_t Anonymizer::anonymize(std::string& buffer) const {
+  char* data = &buffer[0];
+  const std::string_view s{data, buffer.length()};
+  std::size_t count = 0, w = 0, r = 0, i = 0, start = 0, end = 0;
+  char text[INET6_ADDRSTRLEN];
+  while (next(s, i, start, end)) {
+    std::size_t length;
+    Address masked;
+    if (!this->find(s, start, end, length, masked))
+      continue;
+    const std::size_t size = masked.format(text);
+    if (size > length + (r - w)) {
+      // No room to compact this replacement; finish through a copy
+      std::string out{s.substr(0, w)};
+      out.append(s.substr(r, start - r));
+      w = r = start;
+      count += this->anonymize(s.substr(r), out);
+      buffer.swap(out);
+      return count;
+    }
+    // The text between replacements shifts left as the buffer shrinks
+    if (w != r)
+      std::char_traits<char>::move(data + w, data + r, start - r);
+    w += start - r;
+    std::char_traits<char>::copy(data + w, text, size);
+    w += size;
+    r = start + length;
+    count++;
+  }
+  if (w != r) {
+    std::char_traits<char>::move(data + w, data + r, s.length() - r);
+    buffer.resize(w + s.length() - r);
+  }
+  return count;
+}
+
+/**
+ * @brief Anonymize
+ *
+ * Truncates every numeric IPv4 and IPv6 address in a buffer to its
+ * configured prefix, appending the rewritten text to `out`
+ *
+ * @param      in  The text to anonymize
+ * @param[out] out The string to which the rewritten text is appended
+ *
+ * @return The number of addresses rewritten
+ */
+std::size_t Anonymizer::anonymize(std::string_view in,
+    std::string& out) const {
+  std::size_t count = 0, r = 0, i = 0, start = 0, end = 0;
+  char text[INET6_ADDRSTRLEN];
+  out.reserve(out.length() + in.length());
+  while (next(in, i, start, end)) {
+    std::size_t length;
+    Address masked;
+    if (!this->find(in, start, end, length, masked))
+      continue;
+    out.append(in.substr(r, start - r));
+    out.append(text, masked.format(text));
+    r = start + length;
+    count++;
+  }
+  out.append(in.substr(r));
+  return count;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file  Anonymizer.hpp
+ * @brief Anonymizer
+ *
+ * Class definition for Anonymizer
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _ANONYMIZER_HPP
+#define _ANONYMIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "Address.hpp"
+
+class Anonymizer {
+  private:
+    std::uint8_t prefix4;
+    std::uint8_t prefix6;
+
+    bool match(std::string_view run, std::size_t& length,
+      Address& masked) const;
+    bool find(std::string_view s, std::size_t& start, std::size_t end,
+      std::size_t& length, Address& masked) const;
+
+  public:
+    Anonymizer(std::uint8_t prefix4 = 24, std::uint8_t prefix6 = 48);
+    std::size_t anonymize(std::string& buffer) const;
+    std::size_t anonymize(std::string_view in, std::string& out) const;
+};
+
+#endif
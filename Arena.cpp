@@ -0,0 +1,84 @@
+/**
+ * @file  Arena.cpp
+ * @brief Arena
+ *
+ * Class implementation for Arena
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include "Arena.hpp"
+
+/**
+ * @brief Arena
+ *
+ * Constructs an empty arena that hands out byte storage from large blocks,
+ * all of which are released together
+ *
+ * @param block_size The size of the first block; later blocks double in size
+ *                   up to 1 MiB (or `block_size`, if that is larger)
+ */
+Arena::Arena(std::size_t block_size): initial{
+  block_size > 0 ? block_size : 1}, block_size{initial} {}
+
+/**
+ * @brief Allocate
+ *
+ * Reserves storage for `n` bytes that remains valid until the arena is
+ * cleared or destroyed
+ *
+ * @param n Number of bytes to reserve
+ *
+ * @return Pointer to the reserved storage
+ */
+char* Arena::allocate(std::size_t n) {
+  if (n > this->remaining) {
+    // Start a new block large enough for this request
+    std::size_t size = std::max(n, this->block_size);
+    this->blocks.emplace_back(new char[size]);
+    this->cursor    = this->blocks.back().get();
+    this->remaining = size;
+    this->block_size = std::min(this->block_size * 2,
+      std::max(this->initial, std::size_t{1} << 20));
+  }
+  char* result = this->cursor;
+  this->cursor    += n;
+  this->remaining -= n;
+  return result;
+}
+
+/**
+ * @brief Clear
+ *
+ * Releases every block, invalidating all storage handed out so far, and
+ * starts again from the initial block size
+ */
+void Arena::clear() {
+  this->blocks.clear();
+  this->cursor     = nullptr;
+  this->remaining  = 0;
+  this->block_size = this->initial;
+}
+
+/**
+ * @brief Store
+ *
+ * Copies a std::string_view into the arena
+ *
+ * @param s The bytes to copy
+ *
+ * @return std::string_view of the copy
+ */
+std::string_view Arena::store(std::string_view s) {
+  if (s.length() == 0)
+    return {};
+  char* data = this->allocate(s.length());
+  memcpy(data, s.data(), s.length());
+  return {data, s.length()};
+}
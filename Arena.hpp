@@ -0,0 +1,33 @@
+/**
+ * @file  Arena.hpp
+ * @brief Arena
+ *
+ * Class definition for Arena
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _ARENA_HPP
+#define _ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+class Arena {
+  private:
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char*                                cursor    = nullptr;
+    std::size_t                          remaining = 0;
+    std::size_t                          initial;
+    std::size_t                          block_size;
+  public:
+    Arena(std::size_t block_size = 4096);
+    char* allocate(std::size_t n);
+    void clear();
+    std::string_view store(std::string_view s);
+};
+
+#endif
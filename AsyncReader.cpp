@@ -0,0 +1,379 @@
+/**
+ * @file  AsyncReader.cpp
+ * @brief AsyncReader
+ *
+ * Class implementation for AsyncReader
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <vector>
+#include "AsyncReader.hpp"
+#include "Splitter.hpp"
+
+/**
+ * @brief AsyncReader
+ *
+ * Opens a file for reading with multiple in-flight fixed buffers through
+ * io_uring, falling back to blocking reads when io_uring is unavailable
+ *
+ * @param path        Path of the file to read
+ * @param buffers     Number of buffers (and therefore reads) kept in flight
+ * @param buffer_size Size in bytes of each buffer
+ *
+ * @throws `std::runtime_error` when the file cannot be opened or the buffers
+ * cannot be allocated
+ */
+AsyncReader::AsyncReader(const std::string& path, std::size_t buffers,
+    std::size_t buffer_size): count{buffers > 0 ? buffers : 1},
+    size{buffer_size > 0 ? buffer_size : 1}, slots(count) {
+  if ((this->fd = open(path.c_str(), O_RDONLY | O_CLOEXEC)) < 0)
+    throw std::runtime_error{"Could not open the provided file."};
+  // Allocate page aligned storage for all buffers in one block
+  void* block = nullptr;
+  if (posix_memalign(&block, 4096, this->count * this->size) != 0) {
+    close(this->fd);
+    throw std::runtime_error{"Could not allocate the read buffers."};
+  }
+  this->memory = static_cast<char*>(block);
+  // Any failure to set up io_uring leaves the blocking fallback in place
+  if (!this->setup())
+    this->teardown();
+}
+
+/**
+ * @brief ~AsyncReader
+ *
+ * Waits for any reads still in flight, then releases the ring, buffers and
+ * file descriptor
+ */
+AsyncReader::~AsyncReader() {
+  this->teardown();
+  free(this->memory);
+  close(this->fd);
+}
+
+/**
+ * @brief Setup
+ *
+ * Creates the io_uring instance, maps its queues and registers the file and
+ * buffers with the kernel
+ *
+ * @return `true` on success, otherwise `false`
+ */
+bool AsyncReader::setup() {
+  struct io_uring_params params = {};
+  this->ring = static_cast<int>(syscall(__NR_io_uring_setup,
+    static_cast<unsigned>(this->count), &params));
+  if (this->ring < 0)
+    return false;
+
+  // Map the submission queue ring, completion queue ring and SQE array
+  this->sq_length = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  this->cq_length = params.cq_off.cqes +
+    params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    this->sq_length = this->cq_length =
+      std::max(this->sq_length, this->cq_length);
+  this->sq_map = mmap(nullptr, this->sq_length, PROT_READ | PROT_WRITE,
+    MAP_SHARED | MAP_POPULATE, this->ring, IORING_OFF_SQ_RING);
+  if (this->sq_map == MAP_FAILED)
+    return this->sq_map = nullptr, false;
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    this->cq_map = this->sq_map;
+  else if ((this->cq_map = mmap(nullptr, this->cq_length,
+      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->ring,
+      IORING_OFF_CQ_RING)) == MAP_FAILED)
+    return this->cq_map = nullptr, false;
+  this->sqe_length = params.sq_entries * sizeof(struct io_uring_sqe);
+  this->sqe_map = mmap(nullptr, this->sqe_length, PROT_READ | PROT_WRITE,
+    MAP_SHARED | MAP_POPULATE, this->ring, IORING_OFF_SQES);
+  if (this->sqe_map == MAP_FAILED)
+    return this->sqe_map = nullptr, false;
+
+  // Resolve the ring pointers from the offsets provided by the kernel
+  char* sq = static_cast<char*>(this->sq_map);
+  char* cq = static_cast<char*>(this->cq_map);
+  this->sq_head  = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  this->sq_tail  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  this->sq_mask  = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  this->sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  this->cq_head  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  this->cq_tail  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  this->cq_mask  = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  this->cqes     = cq + params.cq_off.cqes;
+
+  // Register the file and one fixed buffer per slot
+  std::vector<struct iovec> iov(this->count);
+  for (std::size_t i = 0; i < this->count; i++)
+    iov[i].iov_base = this->memory + i * this->size,
+    iov[i].iov_len  = this->size;
+  if (syscall(__NR_io_uring_register, this->ring, IORING_REGISTER_FILES,
+      &this->fd, 1) < 0 || syscall(__NR_io_uring_register, this->ring,
+      IORING_REGISTER_BUFFERS, iov.data(),
+      static_cast<unsigned>(this->count)) < 0)
+    return false;
+  return true;
+}
+
+/**
+ * @brief Teardown
+ *
+ * Waits for outstanding reads so the kernel no longer writes into the
+ * buffers, then unmaps the queues and closes the ring
+ *
+ * @remarks Should the wait itself fail, the buffers are deliberately leaked
+ * rather than freed while the kernel may still write into them.
+ */
+void AsyncReader::teardown() {
+  if (this->ring >= 0 && this->cqes != nullptr && !this->drain())
+    this->memory = nullptr;
+  if (this->sqe_map != nullptr)
+    munmap(this->sqe_map, this->sqe_length);
+  if (this->cq_map != nullptr && this->cq_map != this->sq_map)
+    munmap(this->cq_map, this->cq_length);
+  if (this->sq_map != nullptr)
+    munmap(this->sq_map, this->sq_length);
+  if (this->ring >= 0)
+    close(this->ring);
+  this->sqe_map = this->cq_map = this->sq_map = nullptr;
+  this->cqes = nullptr;
+  this->ring = -1;
+}
+
+/**
+ * @brief Drain
+ *
+ * Submits anything still queued and discards completions until no read is
+ * in flight, without continuing short reads or throwing
+ *
+ * @return `true` once every read has completed, `false` if waiting failed
+ */
+bool AsyncReader::drain() {
+  while (this->inflight > 0) {
+    unsigned queued = __atomic_load_n(this->sq_tail, __ATOMIC_RELAXED) -
+      __atomic_load_n(this->sq_head, __ATOMIC_ACQUIRE);
+    if (syscall(__NR_io_uring_enter, this->ring, queued, 1,
+        IORING_ENTER_GETEVENTS, nullptr, 0) < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    unsigned head = *this->cq_head;
+    unsigned tail = __atomic_load_n(this->cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++, this->inflight--)
+      this->slots[static_cast<std::size_t>(static_cast<struct io_uring_cqe*>(
+        this->cqes)[head & *this->cq_mask].user_data)].done = true;
+    __atomic_store_n(this->cq_head, head, __ATOMIC_RELEASE);
+  }
+  return true;
+}
+
+/**
+ * @brief Submit
+ *
+ * Queues a fixed buffer read filling the remainder of the given slot
+ *
+ * @param i Index of the slot (and registered buffer) to fill
+ */
+void AsyncReader::submit(std::size_t i) {
+  Slot& slot = this->slots[i];
+  unsigned tail  = *this->sq_tail;
+  unsigned index = tail & *this->sq_mask;
+  struct io_uring_sqe* sqe =
+    static_cast<struct io_uring_sqe*>(this->sqe_map) + index;
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode    = IORING_OP_READ_FIXED;
+  sqe->flags     = IOSQE_FIXED_FILE;
+  sqe->fd        = 0;
+  sqe->off       = slot.offset + slot.filled;
+  sqe->addr      = reinterpret_cast<std::uint64_t>(
+    this->memory + i * this->size + slot.filled);
+  sqe->len       = static_cast<std::uint32_t>(this->size - slot.filled);
+  sqe->buf_index = static_cast<std::uint16_t>(i);
+  sqe->user_data = i;
+  this->sq_array[index] = index;
+  // Publish the entry; `flush` hands it to the kernel
+  __atomic_store_n(this->sq_tail, tail + 1, __ATOMIC_RELEASE);
+  this->inflight++;
+}
+
+/**
+ * @brief Flush
+ *
+ * Hands every queued read to the kernel without waiting, so that the reads
+ * proceed while the caller processes earlier chunks
+ *
+ * @throws `std::runtime_error` when the reads cannot be submitted
+ */
+void AsyncReader::flush() {
+  unsigned queued;
+  while ((queued = __atomic_load_n(this->sq_tail, __ATOMIC_RELAXED) -
+      __atomic_load_n(this->sq_head, __ATOMIC_ACQUIRE)) > 0)
+    if (syscall(__NR_io_uring_enter, this->ring, queued, 0, 0, nullptr,
+        0) < 0 && errno != EINTR)
+      throw std::runtime_error{"Could not submit the queued reads."};
+}
+
+/**
+ * @brief Reap
+ *
+ * Submits any queued reads, waits for at least one completion, updates the
+ * state of every slot that completed and submits continuations of short reads
+ *
+ * @throws `std::runtime_error` when a read fails
+ */
+void AsyncReader::reap() {
+  unsigned queued = __atomic_load_n(this->sq_tail, __ATOMIC_RELAXED) -
+    __atomic_load_n(this->sq_head, __ATOMIC_ACQUIRE);
+  while (syscall(__NR_io_uring_enter, this->ring, queued, 1,
+      IORING_ENTER_GETEVENTS, nullptr, 0) < 0)
+    if (errno != EINTR)
+      throw std::runtime_error{"Could not wait for read completion."};
+
+  unsigned head = *this->cq_head;
+  unsigned tail = __atomic_load_n(this->cq_tail, __ATOMIC_ACQUIRE);
+  for (; head != tail; head++) {
+    const struct io_uring_cqe& cqe =
+      static_cast<struct io_uring_cqe*>(this->cqes)[head & *this->cq_mask];
+    std::size_t i = static_cast<std::size_t>(cqe.user_data);
+    Slot& slot = this->slots[i];
+    this->inflight--;
+    if (cqe.res < 0 && cqe.res != -EINTR && cqe.res != -EAGAIN) {
+      __atomic_store_n(this->cq_head, head + 1, __ATOMIC_RELEASE);
+      slot.done = true;
+      throw std::runtime_error{"Could not read from the provided file."};
+    }
+    if (cqe.res == 0)
+      // Reading at or past the end of the file completes the slot
+      slot.done = slot.eof = true;
+    else if (cqe.res > 0 &&
+        (slot.filled += static_cast<std::size_t>(cqe.res)) == this->size)
+      slot.done = true;
+    // Short or interrupted reads are continued in the same slot
+    if (!slot.done)
+      this->submit(i);
+  }
+  __atomic_store_n(this->cq_head, head, __ATOMIC_RELEASE);
+  this->flush();
+}
+
+/**
+ * @brief Read
+ *
+ * Reads the file from start to end, invoking the callback with each chunk in
+ * file order while the following chunks are already being read
+ *
+ * @param cb Callback invoked with each chunk of the file
+ *
+ * @throws `std::runtime_error` when a read fails
+ */
+void AsyncReader::read(const Callback& cb) {
+  if (this->uring())
+    this->read_uring(cb);
+  else
+    this->read_blocking(cb);
+}
+
+/**
+ * @brief Read (Blocking)
+ *
+ * Fallback for kernels without io_uring that reads one chunk at a time
+ *
+ * @param cb Callback invoked with each chunk of the file
+ */
+void AsyncReader::read_blocking(const Callback& cb) {
+  std::uint64_t offset = 0;
+  for (;;) {
+    ssize_t length = pread(this->fd, this->memory, this->size,
+      static_cast<off_t>(offset));
+    if (length < 0 && errno == EINTR)
+      continue;
+    if (length < 0)
+      throw std::runtime_error{"Could not read from the provided file."};
+    if (length == 0)
+      break;
+    cb(this->memory, static_cast<std::size_t>(length));
+    offset += static_cast<std::uint64_t>(length);
+  }
+}
+
+/**
+ * @brief Read (io_uring)
+ *
+ * Keeps every slot busy with a read of the next unread region of the file,
+ * handing completed slots to the callback strictly in file order
+ *
+ * @param cb Callback invoked with each chunk of the file
+ */
+void AsyncReader::read_uring(const Callback& cb) {
+  std::uint64_t offset = 0;
+  // Start a read in every slot
+  for (std::size_t i = 0; i < this->count; i++, offset += this->size)
+    this->slots[i] = Slot{offset, 0, false, false},
+    this->submit(i);
+  this->flush();
+
+  for (std::size_t current = 0;; current = (current + 1) % this->count) {
+    Slot& slot = this->slots[current];
+    while (!slot.done)
+      this->reap();
+    if (slot.filled > 0)
+      cb(this->memory + current * this->size, slot.filled);
+    if (slot.eof)
+      break;
+    // Reuse this slot for the next unread region
+    slot = Slot{offset, 0, false, false};
+    offset += this->size;
+    // Submit now so the read overlaps the callback for the next chunk
+    this->submit(current);
+    this->flush();
+  }
+
+  // Wait for reads beyond the end of the file before the buffers are reused
+  for (std::size_t i = 0; i < this->count; i++)
+    while (!this->slots[i].done)
+      this->reap();
+}
+
+/**
+ * @brief Split
+ *
+ * Reads the file through the provided Splitter so that field scanning of one
+ * chunk overlaps the reads of the following chunks
+ *
+ * @param s  The Splitter used to separate fields
+ * @param cb Callback invoked with each field, including the final one
+ */
+void AsyncReader::split(Splitter& s, const Splitter::Callback& cb) {
+  this->read([&s, &cb](const char* data, std::size_t length) {
+    s.feed(data, length, cb);
+  });
+  s.finish(cb);
+}
+
+/**
+ * @brief Uring
+ *
+ * Determines whether reads are performed through io_uring
+ *
+ * @return `true` if io_uring is in use, `false` for blocking reads
+ */
+bool AsyncReader::uring() const {
+  return this->ring >= 0;
+}
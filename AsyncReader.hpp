@@ -0,0 +1,73 @@
+/**
+ * @file  AsyncReader.hpp
+ * @brief AsyncReader
+ *
+ * Class definition for AsyncReader
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _ASYNCREADER_HPP
+#define _ASYNCREADER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Splitter.hpp"
+
+class AsyncReader {
+  public:
+    typedef std::function<void(const char*, std::size_t)> Callback;
+  private:
+    struct Slot {
+      std::uint64_t offset = 0;
+      std::size_t   filled = 0;
+      bool          done   = true;
+      bool          eof    = false;
+    };
+    int                 fd     = -1;
+    int                 ring   = -1;
+    char*               memory = nullptr;
+    std::size_t         count  = 0;
+    std::size_t         size   = 0;
+    std::vector<Slot>   slots;
+    // Reads submitted (or queued) whose completions have not been reaped
+    std::size_t         inflight = 0;
+    // Memory mapped io_uring submission and completion queues
+    void*               sq_map    = nullptr;
+    std::size_t         sq_length = 0;
+    void*               cq_map    = nullptr;
+    std::size_t         cq_length = 0;
+    void*               sqe_map   = nullptr;
+    std::size_t         sqe_length = 0;
+    unsigned*           sq_head   = nullptr;
+    unsigned*           sq_tail   = nullptr;
+    unsigned*           sq_mask   = nullptr;
+    unsigned*           sq_array  = nullptr;
+    unsigned*           cq_head   = nullptr;
+    unsigned*           cq_tail   = nullptr;
+    unsigned*           cq_mask   = nullptr;
+    void*               cqes      = nullptr;
+    bool setup();
+    void teardown();
+    bool drain();
+    void submit(std::size_t i);
+    void flush();
+    void reap();
+    void read_blocking(const Callback& cb);
+    void read_uring(const Callback& cb);
+  public:
+    AsyncReader(const std::string& path, std::size_t buffers = 4,
+      std::size_t buffer_size = 1 << 17);
+    AsyncReader(const AsyncReader&) = delete;
+    AsyncReader& operator=(const AsyncReader&) = delete;
+    ~AsyncReader();
+    void read(const Callback& cb);
+    void split(Splitter& s, const Splitter::Callback& cb);
+    bool uring() const;
+};
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file  CidrAggregator.cpp
+ * @brief CidrAggregator
+ *
+ * Class implementation for CidrAggregator
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <netinet/in.h>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Address.hpp"
+#include "CidrAggregator.hpp"
+#include "Prefix.hpp"
+
+namespace {
+  // Addresses as big-endian integers, kept out of the header because the
+  // 128-bit type is a compiler extension
+  typedef unsigned __int128 Value;
+
+  // Converts an integer back to an Address of the given family
+  Address address(Value v, std::uint8_t family) {
+    Address result;
+    result.family = family;
+    for (std::size_t i = result.length(); i > 0; i--, v >>= 8)
+      result.bytes[i - 1] = static_cast<std::uint8_t>(v);
+    return result;
+  }
+
+  // Converts an Address to an integer so that ranges can be compared
+  Value value(const Address& a) {
+    Value result = 0;
+    for (std::size_t i = 0; i < a.length(); i++)
+      result = result << 8 | a.bytes[i];
+    return result;
+  }
+}
+
+/**
+ * @brief Add
+ *
+ * Adds a single address (a full-length prefix) to the set
+ *
+ * @param a The Address to add
+ */
+void CidrAggregator::add(const Address& a) {
+  this->add(a, a);
+}
+
+/**
+ * @brief Add Range
+ *
+ * Adds an inclusive range of addresses to the set
+ *
+ * @param first The lowest Address in the range
+ * @param last  The highest Address in the range
+ *
+ * @return `false` if the families differ or are unset, otherwise `true`
+ */
+bool CidrAggregator::add(const Address& first, const Address& last) {
+  if (first.family != last.family || first.length() == 0)
+    return false;
+  const bool ordered = value(first) <= value(last);
+  (first.family == AF_INET ? this->ranges4 : this->ranges6).emplace_back(
+    ordered ? first : last, ordered ? last : first);
+  return true;
+}
+
+/**
+ * @brief Add Prefix
+ *
+ * Adds every address of a prefix to the set
+ *
+ * @param p The Prefix to add
+ */
+void CidrAggregator::add(const Prefix& p) {
+  this->add(p.first(), p.last());
+}
+
+/**
+ * @brief Add Text
+ *
+ * Adds an address (`10.0.0.1`), prefix (`10.0.0.0/8`) or inclusive range
+ * (`10.0.0.1-10.0.0.9`) given as text
+ *
+ * @param s The text to parse
+ *
+ * @return `false` if the text could not be parsed, otherwise `true`
+ */
+bool CidrAggregator::add(std::string_view s) {
+  std::size_t dash = s.find('-');
+  if (dash != std::string_view::npos) {
+    Address first, last;
+    return Address::parse(s.substr(0, dash), first) &&
+      Address::parse(s.substr(dash + 1), last) && this->add(first, last);
+  }
+  Prefix p;
+  if (!Prefix::parse(s, p))
+    return false;
+  this->add(p);
+  return true;
+}
+
+/**
+ * @brief Emit
+ *
+ * Sorts and merges overlapping or adjacent ranges, then covers each merged
+ * range with the fewest aligned CIDR blocks
+ *
+ * @param ranges The ranges of one family
+ * @param family The address family of the ranges
+ *
+ * @return The minimal std::vector of Prefix covering exactly the ranges
+ */
+static std::vector<Prefix> emit(
+    const std::vector<std::pair<Address, Address>>& ranges,
+    std::uint8_t family) {
+  const unsigned bits = family == AF_INET ? 32 : 128;
+  const Value max = family == AF_INET ? Value{UINT32_MAX} : ~Value{0};
+  std::vector<Prefix> result;
+  std::vector<std::pair<Value, Value>> r;
+  r.reserve(ranges.size());
+  for (const auto& range : ranges)
+    r.emplace_back(value(range.first), value(range.second));
+  std::sort(r.begin(), r.end());
+
+  std::size_t merged = 0;
+  for (std::size_t i = 1; i < r.size(); i++) {
+    // Join ranges that overlap or touch
+    if (r[merged].second == max || r[i].first <= r[merged].second + 1)
+      r[merged].second = std::max(r[merged].second, r[i].second);
+    else
+      r[++merged] = r[i];
+  }
+  if (r.size() > 0)
+    r.resize(merged + 1);
+
+  for (const auto& range : r) {
+    Value a = range.first;
+    for (;;) {
+      // Grow the block while it stays aligned and within the range (a block
+      // of the whole IPv6 space wraps its size to zero, hence the last test)
+      unsigned k = 0;
+      while (k < bits && (a & ((Value{2} << k) - 1)) == 0 &&
+          a + ((Value{2} << k) - 1) <= range.second &&
+          a + ((Value{2} << k) - 1) >= a)
+        k++;
+      result.emplace_back(address(a, family),
+        static_cast<std::uint8_t>(bits - k));
+      Value end = k == bits ? max : a + ((Value{1} << k) - 1);
+      if (end >= range.second)
+        break;
+      a = end + 1;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Aggregate
+ *
+ * Computes the minimal set of CIDR prefixes covering exactly the addresses
+ * added so far, IPv4 prefixes first, each family in ascending order
+ *
+ * @return std::vector of Prefix
+ */
+std::vector<Prefix> CidrAggregator::aggregate() const {
+  std::vector<Prefix> result = emit(this->ranges4, AF_INET);
+  std::vector<Prefix> v6 = emit(this->ranges6, AF_INET6);
+  result.insert(result.end(), v6.begin(), v6.end());
+  return result;
+}
+
+/**
+ * @brief Clear
+ *
+ * Removes every address from the set
+ */
+void CidrAggregator::clear() {
+  this->ranges4.clear();
+  this->ranges6.clear();
+}
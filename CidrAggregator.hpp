@@ -0,0 +1,35 @@
+/**
+ * @file  CidrAggregator.hpp
+ * @brief CidrAggregator
+ *
+ * Class definition for CidrAggregator
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _CIDRAGGREGATOR_HPP
+#define _CIDRAGGREGATOR_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Address.hpp"
+#include "Prefix.hpp"
+
+class CidrAggregator {
+  private:
+    // Inclusive ranges with `first <= last`, in insertion order
+    std::vector<std::pair<Address, Address>> ranges4;
+    std::vector<std::pair<Address, Address>> ranges6;
+  public:
+    void add(const Address& a);
+    bool add(const Address& first, const Address& last);
+    void add(const Prefix& p);
+    bool add(std::string_view s);
+    std::vector<Prefix> aggregate() const;
+    void clear();
+};
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file  Connector.cpp
+ * @brief Connector
+ *
+ * Class implementation for Connector
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+#include "Address.hpp"
+#include "Connector.hpp"
+
+/**
+ * @brief Interleave
+ *
+ * Orders addresses for connection attempts per RFC 8305 section 4,
+ * alternating families starting with the family of the first address while
+ * otherwise preserving the given order
+ *
+ * @param addresses The candidate addresses in preference order
+ *
+ * @return The interleaved addresses
+ */
+std::vector<Address> Connector::interleave(
+    const std::vector<Address>& addresses) {
+  std::vector<Address> first, second, result;
+  if (addresses.empty())
+    return result;
+  for (const Address& a : addresses) {
+    if (a.family != AF_INET && a.family != AF_INET6)
+      continue;
+    (a.family == addresses.front().family ? first : second).push_back(a);
+  }
+  result.reserve(first.size() + second.size());
+  for (std::size_t i = 0; i < std::max(first.size(), second.size()); i++) {
+    if (i < first.size())
+      result.push_back(first[i]);
+    if (i < second.size())
+      result.push_back(second[i]);
+  }
+  return result;
+}
+
+/**
+ * @brief Connect
+ *
+ * Connects a TCP socket to the first reachable address using the Happy
+ * Eyeballs algorithm (RFC 8305): families are interleaved, a new attempt
+ * starts whenever the previous one fails or has been pending for `delay`
+ * milliseconds, and the first attempt to complete wins
+ *
+ * @remarks Attempts run concurrently on non-blocking sockets multiplexed
+ * with poll(), so an unreachable address costs at most `delay` rather than a
+ * full connect timeout. Losing attempts are closed.
+ *
+ * @param addresses The candidate addresses (with ports) in preference order
+ * @param timeout   Overall time limit in milliseconds
+ * @param delay     Milliseconds between starting attempts (RFC 8305
+ *                  recommends 250)
+ *
+ * @throws `std::runtime_error` if no address could be connected in time
+ *
+ * @return The connected socket descriptor in blocking mode, owned by the
+ * caller
+ */
+int Connector::connect(const std::vector<Address>& addresses, int timeout,
+    int delay) {
+  using clock = std::chrono::steady_clock;
+  const std::vector<Address> order = Connector::interleave(addresses);
+  const clock::time_point deadline = clock::now() +
+    std::chrono::milliseconds{timeout};
+  clock::time_point next = clock::now();
+  std::vector<struct pollfd> pending;
+  std::size_t started = 0;
+  int winner = -1;
+
+  while (winner < 0) {
+    const clock::time_point now = clock::now();
+    if (now >= deadline)
+      break;
+    // Start the next attempt when it is due or nothing else is in flight
+    if (started < order.size() && (now >= next || pending.empty())) {
+      const Address& a = order[started++];
+      const struct sockaddr_storage address = a.sockaddr();
+      const int fd = ::socket(a.family, SOCK_STREAM | SOCK_NONBLOCK |
+        SOCK_CLOEXEC, 0);
+      if (fd >= 0) {
+        const int status = ::connect(fd,
+          reinterpret_cast<const struct sockaddr*>(&address),
+          static_cast<socklen_t>(a.family == AF_INET ?
+            sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6)));
+        if (status == 0) {
+          winner = fd;
+          break;
+        }
+        if (errno == EINPROGRESS) {
+          pending.push_back({fd, POLLOUT, 0});
+          next = now + std::chrono::milliseconds{delay};
+          continue;
+        }
+        ::close(fd);
+      }
+      // As with a failure reported by poll(), start the next attempt now
+      next = now;
+      continue;
+    }
+    if (pending.empty())
+      break;
+
+    // Wait for a result, the next attempt or the deadline
+    clock::time_point until = deadline;
+    if (started < order.size())
+      until = std::min(until, next);
+    const int wait = static_cast<int>(std::chrono::ceil<
+      std::chrono::milliseconds>(until - now).count());
+    if (::poll(pending.data(), pending.size(), wait) < 0 && errno != EINTR)
+      break;
+    for (std::size_t i = 0; i < pending.size();) {
+      if (pending[i].revents == 0) {
+        i++;
+        continue;
+      }
+      int error = 0;
+      socklen_t length = sizeof(error);
+      if (getsockopt(pending[i].fd, SOL_SOCKET, SO_ERROR, &error,
+          &length) == 0 && error == 0 && winner < 0) {
+        winner = pending[i].fd;
+      } else {
+        ::close(pending[i].fd);
+        // A failure lets the next attempt start right away
+        next = clock::now();
+      }
+      pending.erase(pending.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+  }
+
+  for (const struct pollfd& p : pending)
+    ::close(p.fd);
+  if (winner < 0)
+    throw std::runtime_error{"Could not connect to any provided address."};
+  const int flags = fcntl(winner, F_GETFL);
+  if (flags >= 0)
+    fcntl(winner, F_SETFL, flags & ~O_NONBLOCK);
+  return winner;
+}
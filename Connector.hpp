@@ -0,0 +1,29 @@
+/**
+ * @file  Connector.hpp
+ * @brief Connector
+ *
+ * Class definition for Connector
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _CONNECTOR_HPP
+#define _CONNECTOR_HPP
+
+#include <vector>
+#include "Address.hpp"
+
+class Connector {
+  private:
+    Connector() {}
+
+    static std::vector<Address> interleave(
+      const std::vector<Address>& addresses);
+
+  public:
+    static int connect(const std::vector<Address>& addresses,
+      int timeout = 10000, int delay = 250);
+};
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * @file  Coroutine.cpp
+ * @brief Coroutine
+ *
+ * Class implementation for Coroutine
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include "Coroutine.hpp"
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Replacer.hpp"
+#include "Splitter.hpp"
+
+namespace {
+  /**
+   * @brief Batch
+   *
+   * Collects the output of one Splitter or Replacer call so it can be
+   * yielded after the call returns, copying only the views that point into
+   * internal buffers (rather than into the chunk or a stable string)
+   */
+  struct Batch {
+    std::vector<std::string_view> views;
+    std::deque<std::string>       copies;
+    std::string_view              chunk;
+    std::string_view              stable;
+
+    static bool within(std::string_view v, std::string_view range) {
+      return std::less_equal<const char*>{}(range.data(), v.data()) &&
+        std::less_equal<const char*>{}(v.data() + v.length(),
+          range.data() + range.length());
+    }
+    void add(std::string_view v) {
+      if (v.length() == 0 || within(v, this->chunk) ||
+          within(v, this->stable))
+        this->views.push_back(v);
+      else
+        this->views.push_back(this->copies.emplace_back(v));
+    }
+    void clear() {
+      this->views.clear();
+      this->copies.clear();
+    }
+  };
+}
+
+/**
+ * @brief Replace (Asynchronous)
+ *
+ * Performs `Utility::replace` over a subject that arrives in chunks from an
+ * asynchronous source, yielding output chunks as soon as they are final
+ *
+ * @param chunks  Source of the subject's chunks
+ * @param search  The substring that will be replaced
+ * @param replace The new value replacing `search`
+ * @param limit   Maximum number of replacements, or zero for no limit
+ *
+ * @return AsyncGenerator of output chunks
+ */
+AsyncGenerator<std::string_view> Coroutine::replace(
+    AsyncGenerator<std::string_view> chunks, std::string search,
+    std::string replace, const int limit) {
+  Replacer replacer{search, replace, limit};
+  Batch batch;
+  batch.stable = replacer.replacement();
+  auto collect = [&batch](std::string_view v) { batch.add(v); };
+  while (co_await chunks.next()) {
+    batch.chunk = chunks.value();
+    replacer.feed(batch.chunk, collect);
+    for (std::string_view v : batch.views)
+      co_yield v;
+    batch.clear();
+  }
+  batch.chunk = {};
+  replacer.finish(collect);
+  for (std::string_view v : batch.views)
+    co_yield v;
+}
+
+/**
+ * @brief Replace
+ *
+ * Performs `Utility::replace` over a subject produced in chunks, yielding
+ * output chunks as soon as they are final
+ *
+ * @param chunks  Source of the subject's chunks
+ * @param search  The substring that will be replaced
+ * @param replace The new value replacing `search`
+ * @param limit   Maximum number of replacements, or zero for no limit
+ *
+ * @return Generator of output chunks
+ */
+Generator<std::string_view> Coroutine::replace(
+    Generator<std::string_view> chunks, std::string search,
+    std::string replace, const int limit) {
+  Replacer replacer{search, replace, limit};
+  Batch batch;
+  batch.stable = replacer.replacement();
+  auto collect = [&batch](std::string_view v) { batch.add(v); };
+  for (std::string_view chunk : chunks) {
+    replacer.feed(batch.chunk = chunk, collect);
+    for (std::string_view v : batch.views)
+      co_yield v;
+    batch.clear();
+  }
+  batch.chunk = {};
+  replacer.finish(collect);
+  for (std::string_view v : batch.views)
+    co_yield v;
+}
+
+/**
+ * @brief Split (Asynchronous)
+ *
+ * Performs `Utility::explode` over input that arrives in chunks from an
+ * asynchronous source, yielding each field as soon as it is complete
+ *
+ * @param chunks Source of the input's chunks
+ * @param d      The delimiter used to separate fields
+ *
+ * @return AsyncGenerator of fields, including the final one
+ */
+AsyncGenerator<std::string_view> Coroutine::split(
+    AsyncGenerator<std::string_view> chunks, std::string d) {
+  Splitter splitter{d};
+  Batch batch;
+  auto collect = [&batch](std::string_view v) { batch.add(v); };
+  while (co_await chunks.next()) {
+    batch.chunk = chunks.value();
+    splitter.feed(batch.chunk, collect);
+    for (std::string_view v : batch.views)
+      co_yield v;
+    batch.clear();
+  }
+  batch.chunk = {};
+  splitter.finish(collect);
+  for (std::string_view v : batch.views)
+    co_yield v;
+}
+
+/**
+ * @brief Split
+ *
+ * Performs `Utility::explode` over input produced in chunks, yielding each
+ * field as soon as it is complete
+ *
+ * @param chunks Source of the input's chunks
+ * @param d      The delimiter used to separate fields
+ *
+ * @return Generator of fields, including the final one
+ */
+Generator<std::string_view> Coroutine::split(
+    Generator<std::string_view> chunks, std::string d) {
+  Splitter splitter{d};
+  Batch batch;
+  auto collect = [&batch](std::string_view v) { batch.add(v); };
+  for (std::string_view chunk : chunks) {
+    splitter.feed(batch.chunk = chunk, collect);
+    for (std::string_view v : batch.views)
+      co_yield v;
+    batch.clear();
+  }
+  batch.chunk = {};
+  splitter.finish(collect);
+  for (std::string_view v : batch.views)
+    co_yield v;
+}
+
+#endif
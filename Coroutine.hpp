@@ -0,0 +1,201 @@
+/**
+ * @file  Coroutine.hpp
+ * @brief Coroutine
+ *
+ * Class definitions for C++20 coroutine generators over the streaming
+ * Splitter and Replacer
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _COROUTINE_HPP
+#define _COROUTINE_HPP
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Generator
+ *
+ * Lazily evaluated, synchronous sequence of values produced by `co_yield`
+ *
+ * @remarks A yielded value remains valid until the generator is advanced.
+ */
+template <typename T>
+class Generator {
+  public:
+    struct promise_type {
+      const std::remove_reference_t<T>* value = nullptr;
+      std::exception_ptr                error;
+      Generator get_return_object() {
+        return Generator{
+          std::coroutine_handle<promise_type>::from_promise(*this)};
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      std::suspend_always yield_value(const std::remove_reference_t<T>& v) {
+        this->value = std::addressof(v);
+        return {};
+      }
+      void return_void() {}
+      void unhandled_exception() { this->error = std::current_exception(); }
+    };
+    class iterator {
+      private:
+        std::coroutine_handle<promise_type> handle;
+      public:
+        typedef std::input_iterator_tag      iterator_category;
+        typedef std::ptrdiff_t               difference_type;
+        typedef std::remove_reference_t<T>   value_type;
+        typedef const value_type&            reference;
+        typedef const value_type*            pointer;
+        iterator(std::coroutine_handle<promise_type> h = nullptr): handle{h} {}
+        reference operator*() const { return *this->handle.promise().value; }
+        pointer operator->() const { return this->handle.promise().value; }
+        iterator& operator++() {
+          Generator::advance(this->handle);
+          return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const {
+          return !this->handle || this->handle.done();
+        }
+    };
+  private:
+    std::coroutine_handle<promise_type> handle;
+    explicit Generator(std::coroutine_handle<promise_type> h): handle{h} {}
+    static void advance(std::coroutine_handle<promise_type> h) {
+      h.resume();
+      if (h.done() && h.promise().error)
+        std::rethrow_exception(std::exchange(h.promise().error, nullptr));
+    }
+  public:
+    Generator(Generator&& other) noexcept:
+      handle{std::exchange(other.handle, nullptr)} {}
+    Generator& operator=(Generator&& other) noexcept {
+      std::swap(this->handle, other.handle);
+      return *this;
+    }
+    ~Generator() {
+      if (this->handle)
+        this->handle.destroy();
+    }
+    iterator begin() {
+      if (this->handle)
+        Generator::advance(this->handle);
+      return iterator{this->handle};
+    }
+    std::default_sentinel_t end() const { return {}; }
+};
+
+/**
+ * @brief Async Generator
+ *
+ * Lazily evaluated sequence of values produced by `co_yield` whose body may
+ * itself `co_await` (e.g. on a network source between values)
+ *
+ * @remarks Consume it from another coroutine with
+ * `while (co_await gen.next()) use(gen.value());`. A yielded value remains
+ * valid until `next()` is awaited again.
+ */
+template <typename T>
+class AsyncGenerator {
+  public:
+    struct promise_type {
+      const std::remove_reference_t<T>* value = nullptr;
+      std::exception_ptr                error;
+      std::coroutine_handle<>           continuation;
+      // Returns control to whichever coroutine awaited next()
+      struct Resume {
+        bool await_ready() noexcept { return false; }
+        std::coroutine_handle<> await_suspend(
+            std::coroutine_handle<promise_type> h) noexcept {
+          return h.promise().continuation;
+        }
+        void await_resume() noexcept {}
+      };
+      AsyncGenerator get_return_object() {
+        return AsyncGenerator{
+          std::coroutine_handle<promise_type>::from_promise(*this)};
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      Resume final_suspend() noexcept {
+        this->value = nullptr;
+        return {};
+      }
+      Resume yield_value(const std::remove_reference_t<T>& v) {
+        this->value = std::addressof(v);
+        return {};
+      }
+      void return_void() {}
+      void unhandled_exception() { this->error = std::current_exception(); }
+    };
+    struct Next {
+      std::coroutine_handle<promise_type> handle;
+      bool await_ready() noexcept {
+        return !this->handle || this->handle.done();
+      }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) {
+        this->handle.promise().continuation = c;
+        return this->handle;
+      }
+      bool await_resume() {
+        if (!this->handle || this->handle.done()) {
+          if (this->handle && this->handle.promise().error)
+            std::rethrow_exception(
+              std::exchange(this->handle.promise().error, nullptr));
+          return false;
+        }
+        return true;
+      }
+    };
+  private:
+    std::coroutine_handle<promise_type> handle;
+    explicit AsyncGenerator(std::coroutine_handle<promise_type> h):
+      handle{h} {}
+  public:
+    AsyncGenerator(AsyncGenerator&& other) noexcept:
+      handle{std::exchange(other.handle, nullptr)} {}
+    AsyncGenerator& operator=(AsyncGenerator&& other) noexcept {
+      std::swap(this->handle, other.handle);
+      return *this;
+    }
+    ~AsyncGenerator() {
+      if (this->handle)
+        this->handle.destroy();
+    }
+    Next next() { return Next{this->handle}; }
+    const std::remove_reference_t<T>& value() const {
+      return *this->handle.promise().value;
+    }
+};
+
+class Coroutine {
+  private:
+    // Prevent this class from being instantiated
+    Coroutine() {}
+  public:
+    static AsyncGenerator<std::string_view> replace(
+      AsyncGenerator<std::string_view> chunks, std::string search,
+      std::string replace, const int limit = 0);
+    static Generator<std::string_view> replace(
+      Generator<std::string_view> chunks, std::string search,
+      std::string replace, const int limit = 0);
+    static AsyncGenerator<std::string_view> split(
+      AsyncGenerator<std::string_view> chunks, std::string d);
+    static Generator<std::string_view> split(
+      Generator<std::string_view> chunks, std::string d);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,382 @@
+/**
+ * @file  Decompressor.cpp
+ * @brief Decompressor
+ *
+ * Class implementation for Decompressor
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <zlib.h>
+#if __has_include(<zstd.h>)
+#include <zstd.h>
+#define UTILITY_HAVE_ZSTD 1
+#endif
+#include "Decompressor.hpp"
+#include "Splitter.hpp"
+
+/**
+ * @brief Read Some
+ *
+ * Reads up to `length` bytes from a file descriptor, retrying on interruption
+ *
+ * @throws `std::runtime_error` when the read fails
+ *
+ * @return The number of bytes read, or zero at the end of the file
+ */
+static std::size_t read_some(int fd, char* data, std::size_t length) {
+  ssize_t result = 0;
+  while ((result = ::read(fd, data, length)) < 0)
+    if (errno != EINTR)
+      throw std::runtime_error{"Could not read from the provided file."};
+  return static_cast<std::size_t>(result);
+}
+
+/**
+ * @brief Decompressor
+ *
+ * Prepares a pipeline that decompresses a gzip or zstd file on a background
+ * thread and hands the decompressed blocks to a consumer on the calling
+ * thread, without any intermediate files
+ *
+ * @remarks Input that is neither gzip nor zstd is passed through unchanged.
+ *
+ * @param path       Path of the (possibly compressed) file to read
+ * @param blocks     Number of decompressed blocks in circulation
+ * @param block_size Size in bytes of each decompressed block
+ */
+Decompressor::Decompressor(const std::string& path, std::size_t blocks,
+    std::size_t block_size): path{path},
+    block_size{block_size > 0 ? block_size : 1},
+    blocks(blocks > 0 ? blocks : 1, std::vector<char>(this->block_size)),
+    // One extra slot is reserved for the end of stream marker
+    full{this->blocks.size() + 1}, empty{this->blocks.size()} {}
+
+/**
+ * @brief Acquire
+ *
+ * Waits for an empty block to decompress into (producer only)
+ *
+ * @param[out] block Storage for the acquired block
+ *
+ * @return `true` on success, `false` if the consumer has stopped
+ */
+bool Decompressor::acquire(Block& block) {
+  while (!this->empty.try_pop(block))
+    if (this->stop.load(std::memory_order_relaxed))
+      return false;
+    else
+      std::this_thread::yield();
+  block.length = 0;
+  return true;
+}
+
+/**
+ * @brief Deliver
+ *
+ * Passes a filled block (or the end of stream marker) to the consumer
+ *
+ * @param block The block to deliver
+ */
+void Decompressor::deliver(Block& block) {
+  while (!this->full.try_push(Block{block}))
+    if (this->stop.load(std::memory_order_relaxed))
+      return;
+    else
+      std::this_thread::yield();
+}
+
+/**
+ * @brief Produce
+ *
+ * Opens the file, detects its format from the leading magic bytes and runs
+ * the matching decoder (producer only)
+ *
+ * @throws `std::runtime_error` on failure to open, read or decode the file
+ */
+void Decompressor::produce() {
+  int fd = open(this->path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    throw std::runtime_error{"Could not open the provided file."};
+  try {
+    // Read until the longest magic number is present (or the file ends), as
+    // a short first read must not hide a compressed format
+    std::vector<char> input(std::max<std::size_t>(this->block_size, 4));
+    std::size_t length = 0, more = 0;
+    do {
+      more = read_some(fd, input.data() + length, input.size() - length);
+      length += more;
+    } while (length < 4 && more > 0);
+    const unsigned char* magic =
+      reinterpret_cast<const unsigned char*>(input.data());
+    if (length >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+      this->gunzip(fd, input, length);
+    else if (length >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 &&
+        magic[2] == 0x2f && magic[3] == 0xfd)
+      this->unzstd(fd, input, length);
+    else
+      this->passthrough(fd, input, length);
+  } catch (...) {
+    close(fd);
+    throw;
+  }
+  close(fd);
+}
+
+/**
+ * @brief Gunzip
+ *
+ * Inflates one or more concatenated gzip members into blocks
+ *
+ * @param fd     The file descriptor to read compressed input from
+ * @param input  Buffer holding the first `length` bytes of compressed input
+ * @param length Number of bytes already present in `input`
+ *
+ * @throws `std::runtime_error` on corrupt or truncated input
+ */
+void Decompressor::gunzip(int fd, std::vector<char>& input,
+    std::size_t length) {
+  // Ensure the inflate state is released on every exit path
+  struct Stream {
+    z_stream z = {};
+    ~Stream() { inflateEnd(&this->z); }
+  } stream;
+  z_stream& z = stream.z;
+  if (inflateInit2(&z, 15 + 16) != Z_OK)
+    throw std::runtime_error{"Could not initialize gzip decompression."};
+
+  Block block;
+  if (!this->acquire(block))
+    return;
+  z.next_in   = reinterpret_cast<Bytef*>(input.data());
+  z.avail_in  = static_cast<uInt>(length);
+  z.next_out  = reinterpret_cast<Bytef*>(this->blocks[block.index].data());
+  z.avail_out = static_cast<uInt>(this->block_size);
+  bool finished = false, flush = false;
+
+  for (;;) {
+    // Refill the input buffer once pending output has been drained
+    if (z.avail_in == 0 && !flush) {
+      if ((length = read_some(fd, input.data(), input.size())) == 0)
+        break;
+      z.next_in  = reinterpret_cast<Bytef*>(input.data());
+      z.avail_in = static_cast<uInt>(length);
+    }
+    if (z.avail_in > 0)
+      finished = false;
+    int result = inflate(&z, Z_NO_FLUSH);
+    if (result == Z_STREAM_END)
+      // Prepare for a following gzip member, if any
+      finished = true, inflateReset(&z);
+    else if (result != Z_OK && result != Z_BUF_ERROR)
+      throw std::runtime_error{"Could not decompress the gzip stream."};
+
+    if ((flush = z.avail_out == 0)) {
+      // Hand the full block to the consumer and continue in a fresh one
+      block.length = this->block_size;
+      this->deliver(block);
+      if (!this->acquire(block))
+        return;
+      z.next_out  = reinterpret_cast<Bytef*>(this->blocks[block.index].data());
+      z.avail_out = static_cast<uInt>(this->block_size);
+    }
+  }
+  if (!finished)
+    throw std::runtime_error{"The gzip stream is truncated."};
+
+  // Deliver the partially filled final block
+  if ((block.length = this->block_size - z.avail_out) > 0)
+    this->deliver(block);
+}
+
+/**
+ * @brief Passthrough
+ *
+ * Copies uncompressed input into blocks unchanged
+ *
+ * @param fd     The file descriptor to read input from
+ * @param input  Buffer holding the first `length` bytes of input
+ * @param length Number of bytes already present in `input`
+ */
+void Decompressor::passthrough(int fd, std::vector<char>& input,
+    std::size_t length) {
+  Block block;
+  if (length == 0 || !this->acquire(block))
+    return;
+  // The sniffed prefix may be longer than one block
+  for (std::size_t offset = 0; offset < length;) {
+    if (block.length == this->block_size) {
+      this->deliver(block);
+      if (!this->acquire(block))
+        return;
+    }
+    const std::size_t n = std::min(length - offset,
+      this->block_size - block.length);
+    memcpy(this->blocks[block.index].data() + block.length,
+      input.data() + offset, n);
+    block.length += n;
+    offset       += n;
+  }
+  for (;;) {
+    if (block.length == this->block_size) {
+      this->deliver(block);
+      if (!this->acquire(block))
+        return;
+    }
+    // Fill the remainder of the current block directly from the file
+    std::size_t more = read_some(fd, this->blocks[block.index].data() +
+      block.length, this->block_size - block.length);
+    if (more == 0)
+      break;
+    block.length += more;
+  }
+  if (block.length > 0)
+    this->deliver(block);
+}
+
+/**
+ * @brief Unzstd
+ *
+ * Decompresses one or more concatenated zstd frames into blocks
+ *
+ * @param fd     The file descriptor to read compressed input from
+ * @param input  Buffer holding the first `length` bytes of compressed input
+ * @param length Number of bytes already present in `input`
+ *
+ * @throws `std::runtime_error` on corrupt or truncated input, or when zstd
+ * support is not available
+ */
+void Decompressor::unzstd(int fd, std::vector<char>& input,
+    std::size_t length) {
+#ifdef UTILITY_HAVE_ZSTD
+  // Ensure the decompression context is released on every exit path
+  struct Stream {
+    ZSTD_DStream* z = ZSTD_createDStream();
+    ~Stream() { ZSTD_freeDStream(this->z); }
+  } stream;
+  if (stream.z == nullptr || ZSTD_isError(ZSTD_initDStream(stream.z)))
+    throw std::runtime_error{"Could not initialize zstd decompression."};
+
+  Block block;
+  if (!this->acquire(block))
+    return;
+  ZSTD_inBuffer  in  = {input.data(), length, 0};
+  ZSTD_outBuffer out = {this->blocks[block.index].data(), this->block_size, 0};
+  std::size_t hint = 0;
+  bool flush = false;
+
+  for (;;) {
+    // Refill the input buffer once pending output has been drained
+    if (in.pos == in.size && !flush) {
+      if ((length = read_some(fd, input.data(), input.size())) == 0)
+        break;
+      in = ZSTD_inBuffer{input.data(), length, 0};
+    }
+    if (ZSTD_isError(hint = ZSTD_decompressStream(stream.z, &out, &in)))
+      throw std::runtime_error{"Could not decompress the zstd stream."};
+
+    if ((flush = out.pos == out.size)) {
+      // Hand the full block to the consumer and continue in a fresh one
+      block.length = this->block_size;
+      this->deliver(block);
+      if (!this->acquire(block))
+        return;
+      out = ZSTD_outBuffer{this->blocks[block.index].data(),
+        this->block_size, 0};
+    }
+  }
+  // A non-zero hint means the decoder still expects more of the last frame
+  if (hint != 0)
+    throw std::runtime_error{"The zstd stream is truncated."};
+
+  // Deliver the partially filled final block
+  if ((block.length = out.pos) > 0)
+    this->deliver(block);
+#else
+  (void)fd, (void)input, (void)length;
+  throw std::runtime_error{"zstd support is not available."};
+#endif
+}
+
+/**
+ * @brief Read
+ *
+ * Runs the pipeline, invoking the callback on the calling thread with each
+ * decompressed block while the following blocks are being decompressed on a
+ * background thread
+ *
+ * @param cb Callback invoked with each decompressed block, in order
+ *
+ * @throws `std::runtime_error` on failure to open, read or decode the file;
+ * exceptions thrown by the callback stop the pipeline and are rethrown
+ */
+void Decompressor::read(const Callback& cb) {
+  Block block;
+  // Reset the rings so that every block starts out empty
+  while (this->full.try_pop(block));
+  while (this->empty.try_pop(block));
+  for (std::size_t i = 0; i < this->blocks.size(); i++)
+    this->empty.try_push(Block{i, 0});
+  this->stop  = false;
+  this->error = nullptr;
+
+  std::thread producer{[this]() {
+    try {
+      this->produce();
+    } catch (...) {
+      this->error = std::current_exception();
+    }
+    // A zero length block marks the end of the stream
+    Block end;
+    this->deliver(end);
+  }};
+
+  try {
+    for (;;) {
+      if (!this->full.try_pop(block)) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (block.length == 0)
+        break;
+      cb(this->blocks[block.index].data(), block.length);
+      // Return the block to the producer for reuse
+      this->empty.try_push(Block{block});
+    }
+  } catch (...) {
+    this->stop = true;
+    producer.join();
+    throw;
+  }
+  producer.join();
+  if (this->error)
+    std::rethrow_exception(this->error);
+}
+
+/**
+ * @brief Split
+ *
+ * Runs the pipeline through the provided Splitter so that splitting on the
+ * calling thread overlaps decompression on the background thread
+ *
+ * @param s  The Splitter used to separate fields
+ * @param cb Callback invoked with each field, including the final one
+ */
+void Decompressor::split(Splitter& s, const Splitter::Callback& cb) {
+  this->read([&s, &cb](const char* data, std::size_t length) {
+    s.feed(data, length, cb);
+  });
+  s.finish(cb);
+}
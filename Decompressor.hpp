@@ -0,0 +1,51 @@
+/**
+ * @file  Decompressor.hpp
+ * @brief Decompressor
+ *
+ * Class definition for Decompressor
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _DECOMPRESSOR_HPP
+#define _DECOMPRESSOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Ring.hpp"
+#include "Splitter.hpp"
+
+class Decompressor {
+  public:
+    typedef std::function<void(const char*, std::size_t)> Callback;
+  private:
+    struct Block {
+      std::size_t index  = 0;
+      std::size_t length = 0;
+    };
+    std::string              path;
+    std::size_t              block_size;
+    std::vector<std::vector<char>> blocks;
+    SpscRing<Block>                full;
+    SpscRing<Block>                empty;
+    std::atomic<bool>              stop{false};
+    std::exception_ptr             error;
+    bool acquire(Block& block);
+    void deliver(Block& block);
+    void produce();
+    void gunzip(int fd, std::vector<char>& input, std::size_t length);
+    void passthrough(int fd, std::vector<char>& input, std::size_t length);
+    void unzstd(int fd, std::vector<char>& input, std::size_t length);
+  public:
+    Decompressor(const std::string& path, std::size_t blocks = 8,
+      std::size_t block_size = 1 << 17);
+    void read(const Callback& cb);
+    void split(Splitter& s, const Splitter::Callback& cb);
+};
+
+#endif
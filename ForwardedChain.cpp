@@ -0,0 +1,181 @@
+/**
+ * @file  ForwardedChain.cpp
+ * @brief ForwardedChain
+ *
+ * Class implementation for ForwardedChain
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "Address.hpp"
+#include "ForwardedChain.hpp"
+#include "PrefixTable.hpp"
+
+/**
+ * @brief Hop
+ *
+ * Parses one hop identifier: a bare address, "a.b.c.d:port", "[v6]" or
+ * "[v6]:port"
+ *
+ * @param      s   The identifier, already trimmed and unquoted
+ * @param[out] out Storage for the parsed Address (including any port)
+ *
+ * @return `true` on success, otherwise `false`
+ */
+bool ForwardedChain::hop(std::string_view s, Address& out) {
+  std::string_view port;
+  if (!s.empty() && s[0] == '[') {
+    const std::size_t close = s.find(']');
+    if (close == std::string_view::npos)
+      return false;
+    if (close + 1 < s.length()) {
+      if (s[close + 1] != ':')
+        return false;
+      port = s.substr(close + 2);
+      if (port.empty())
+        return false;
+    }
+    s = s.substr(1, close - 1);
+    if (!Address::parse(s, out) || out.family != AF_INET6)
+      return false;
+  } else {
+    const std::size_t colon = s.find(':');
+    if (colon != std::string_view::npos && colon == s.rfind(':')) {
+      port = s.substr(colon + 1);
+      if (port.empty())
+        return false;
+      s = s.substr(0, colon);
+    }
+    if (!Address::parse(s, out))
+      return false;
+  }
+  std::uint32_t value = 0;
+  for (char c : port) {
+    if (c < '0' || c > '9' || (value = value * 10 +
+        static_cast<std::uint32_t>(c - '0')) > 65535)
+      return false;
+  }
+  out.port = static_cast<std::uint16_t>(value);
+  return true;
+}
+
+/**
+ * @brief Previous
+ *
+ * Splits the last `delimiter`-separated item from `s`, ignoring delimiters
+ * inside quoted strings (honouring backslash escapes)
+ *
+ * @param[in,out] s         The unread text, shortened past the item
+ * @param         delimiter The item delimiter
+ *
+ * @return The last item (untrimmed)
+ */
+std::string_view ForwardedChain::previous(std::string_view& s,
+    char delimiter) {
+  bool quoted = false;
+  std::size_t i = s.length();
+  while (i > 0) {
+    const char c = s[i - 1];
+    if (c == '"') {
+      // A quote preceded by an odd number of backslashes is escaped
+      std::size_t slashes = 0;
+      while (i - 1 > slashes && s[i - 2 - slashes] == '\\')
+        slashes++;
+      if (slashes % 2 == 0)
+        quoted = !quoted;
+    } else if (c == delimiter && !quoted) {
+      break;
+    }
+    i--;
+  }
+  const std::string_view item = s.substr(i);
+  s = s.substr(0, i > 0 ? i - 1 : 0);
+  return item;
+}
+
+/**
+ * @brief Trim
+ *
+ * Removes optional whitespace (spaces and tabs) from both ends of a view
+ *
+ * @param s The view to trim
+ *
+ * @return The trimmed view
+ */
+std::string_view ForwardedChain::trim(std::string_view s) {
+  while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+    s.remove_prefix(1);
+  while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+    s.remove_suffix(1);
+  return s;
+}
+
+/**
+ * @brief Walk
+ *
+ * Resolves the client address from an X-Forwarded-For or RFC 7239 Forwarded
+ * header by walking its hops right to left, stopping at the first hop that
+ * is not in the trusted set
+ *
+ * @remarks Nothing is allocated and nothing is thrown; `hops` receives the
+ * addresses visited, nearest first, so the last one stored is the client when
+ * the Status is `Client`. Multiple header lines should be joined with ",".
+ * Empty X-Forwarded-For entries are skipped. Forwarded elements without a
+ * "for" parameter, or with "unknown" or an obfuscated identifier, stop the
+ * walk with `Opaque`.
+ *
+ * @param      header   The header value
+ * @param      syntax   The header syntax
+ * @param      trusted  Prefixes of trusted proxies (any value matches)
+ * @param[out] hops     Storage for the visited addresses
+ * @param      capacity The number of elements in `hops`
+ * @param[out] count    The number of addresses stored
+ *
+ * @return The Status describing why the walk stopped
+ */
+ForwardedChain::Status ForwardedChain::walk(std::string_view header,
+    Syntax syntax, const PrefixTable& trusted, Address* hops,
+    std::size_t capacity, std::size_t& count) {
+  count = 0;
+  while (!header.empty()) {
+    std::string_view item = ForwardedChain::trim(
+      ForwardedChain::previous(header, ','));
+    if (syntax == Syntax::Forwarded) {
+      // Find the "for" parameter among the ';'-separated pairs
+      std::string_view value;
+      bool found = false;
+      while (!item.empty() && !found) {
+        std::string_view pair = ForwardedChain::trim(
+          ForwardedChain::previous(item, ';'));
+        if (pair.length() > 4 && (pair[0] | 0x20) == 'f' &&
+            (pair[1] | 0x20) == 'o' && (pair[2] | 0x20) == 'r' &&
+            pair[3] == '=')
+          value = pair.substr(4), found = true;
+      }
+      if (value.length() >= 2 && value.front() == '"' &&
+          value.back() == '"')
+        value = value.substr(1, value.length() - 2);
+      if (!found || value.empty() || value == "unknown" || value[0] == '_')
+        return Status::Opaque;
+      if (value.find('\\') != std::string_view::npos)
+        return Status::Invalid;
+      item = value;
+    } else if (item.empty()) {
+      continue;
+    }
+    if (count == capacity)
+      return Status::Overflow;
+    Address& address = hops[count];
+    if (!ForwardedChain::hop(item, address))
+      return Status::Invalid;
+    count++;
+    std::uint32_t value;
+    if (!trusted.lookup(address, value))
+      return Status::Client;
+  }
+  return Status::Trusted;
+}
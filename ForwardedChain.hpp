@@ -0,0 +1,50 @@
+/**
+ * @file  ForwardedChain.hpp
+ * @brief ForwardedChain
+ *
+ * Class definition for ForwardedChain
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _FORWARDEDCHAIN_HPP
+#define _FORWARDEDCHAIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "Address.hpp"
+
+class PrefixTable;
+
+class ForwardedChain {
+  public:
+    enum class Syntax : std::uint8_t { XForwardedFor, Forwarded };
+    enum class Status : std::uint8_t {
+      // Stopped at an untrusted hop, the last one stored
+      Client,
+      // Every hop was trusted; the last one stored is the leftmost
+      Trusted,
+      // Stopped at an "unknown" or obfuscated RFC 7239 identifier
+      Opaque,
+      // Stopped at an entry that is not an address
+      Invalid,
+      // Stopped because the output array was full
+      Overflow
+    };
+
+  private:
+    ForwardedChain() {}
+
+    static bool hop(std::string_view s, Address& out);
+    static std::string_view previous(std::string_view& s, char delimiter);
+    static std::string_view trim(std::string_view s);
+
+  public:
+    static Status walk(std::string_view header, Syntax syntax,
+      const PrefixTable& trusted, Address* hops, std::size_t capacity,
+      std::size_t& count);
+};
+
+#endif
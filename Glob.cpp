@@ -0,0 +1,298 @@
+/**
+ * @file  Glob.cpp
+ * @brief Glob
+ *
+ * Class implementation for Glob
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Glob.hpp"
+#include "Utility.hpp"
+
+namespace {
+  /**
+   * @brief Advance
+   *
+   * Shifts a multi-word Shift-And state left by one bit, setting the lowest
+   * bit so that a new partial match may start at the next position
+   */
+  void advance(std::vector<std::uint64_t>& state) {
+    std::uint64_t carry = 1;
+    for (std::uint64_t& word : state) {
+      const std::uint64_t next = word >> 63;
+      word = (word << 1) | carry;
+      carry = next;
+    }
+  }
+}
+
+/**
+ * @brief Glob
+ *
+ * Compiles a wildcard pattern in which `*` matches any sequence of bytes, `?`
+ * matches any single byte and `\` escapes the following byte. Matching never
+ * backtracks across a `*`, so its cost is bounded regardless of the pattern.
+ *
+ * @remarks In path mode the pattern and subject are split on `/`: `*` and `?`
+ * match within one path segment and a `**` segment matches any number of
+ * whole segments (including none).
+ *
+ * @param pattern The wildcard pattern
+ * @param path    Whether to match whole `/` separated paths
+ */
+Glob::Glob(std::string_view pattern, bool path): runs(1), path{path} {
+  if (!path) {
+    this->runs.back().push_back(Glob::compile(pattern));
+    return;
+  }
+  for (std::string_view element : Utility::explode_view(pattern, "/")) {
+    if (element != "**")
+      this->runs.back().push_back(Glob::compile(element));
+    // Start a new run unless `**` segments are consecutive
+    else if (this->runs.size() == 1 || this->runs.back().size() > 0)
+      this->runs.emplace_back();
+  }
+}
+
+/**
+ * @brief Compile
+ *
+ * Splits a single segment pattern into pieces separated by `*` and prepares
+ * each piece for searching
+ *
+ * @param pattern The segment pattern
+ *
+ * @return The compiled Segment
+ */
+Glob::Segment Glob::compile(std::string_view pattern) {
+  Segment segment;
+  segment.pieces.emplace_back();
+  for (std::size_t i = 0; i < pattern.length(); i++) {
+    Piece& piece = segment.pieces.back();
+    if (pattern[i] == '*')
+      segment.pieces.emplace_back();
+    else if (pattern[i] == '?')
+      piece.bytes.push_back('\0'), piece.any.push_back(true),
+      piece.literal = false;
+    else {
+      // A trailing backslash stands for itself
+      if (pattern[i] == '\\' && i + 1 < pattern.length())
+        i++;
+      piece.bytes.push_back(pattern[i]), piece.any.push_back(false);
+    }
+  }
+
+  // Pieces with wildcards are searched with Shift-And, using one mask of
+  // `words` 64-bit words for each byte value
+  for (Piece& piece : segment.pieces) {
+    if (piece.literal)
+      continue;
+    const std::size_t words = (piece.bytes.length() + 63) / 64;
+    piece.masks.assign(256 * words, 0);
+    for (std::size_t i = 0; i < piece.bytes.length(); i++)
+      for (std::size_t c = 0; c < 256; c++)
+        if (piece.any[i] || static_cast<unsigned char>(piece.bytes[i]) == c)
+          piece.masks[c * words + i / 64] |= std::uint64_t{1} << (i % 64);
+  }
+  return segment;
+}
+
+/**
+ * @brief Piece At
+ *
+ * Determines whether the piece matches the subject at a given offset
+ *
+ * @param s      The subject
+ * @param offset Offset at which the piece must match
+ *
+ * @return `true` on a match, otherwise `false`
+ */
+bool Glob::Piece::at(std::string_view s, std::size_t offset) const {
+  if (offset + this->bytes.length() > s.length())
+    return false;
+  if (this->literal)
+    return memcmp(s.data() + offset, this->bytes.data(),
+      this->bytes.length()) == 0;
+  for (std::size_t i = 0; i < this->bytes.length(); i++)
+    if (!this->any[i] && s[offset + i] != this->bytes[i])
+      return false;
+  return true;
+}
+
+/**
+ * @brief Piece Find
+ *
+ * Finds the leftmost occurrence of the piece lying within `[offset, end)`
+ *
+ * @remarks Literal pieces use `memmem` and wildcard pieces use Shift-And,
+ * which takes a single pass over the region with `ceil(m / 64)` word
+ * operations per byte for a piece of `m` bytes.
+ *
+ * @param s      The subject
+ * @param offset Start of the region to search
+ * @param end    End of the region to search
+ *
+ * @return Offset of the occurrence, or `std::string_view::npos`
+ */
+std::size_t Glob::Piece::find(std::string_view s, std::size_t offset,
+    std::size_t end) const {
+  const std::size_t m = this->bytes.length();
+  if (m == 0)
+    return offset;
+  if (offset > end || end - offset < m)
+    return std::string_view::npos;
+  if (this->literal) {
+    const void* found = memmem(s.data() + offset, end - offset,
+      this->bytes.data(), m);
+    return found == nullptr ? std::string_view::npos :
+      static_cast<const char*>(found) - s.data();
+  }
+  const std::uint64_t accept = std::uint64_t{1} << ((m - 1) % 64);
+  if (m <= 64) {
+    std::uint64_t state = 0;
+    for (std::size_t i = offset; i < end; i++)
+      if ((state = ((state << 1) | 1) &
+          this->masks[static_cast<unsigned char>(s[i])]) & accept)
+        return i + 1 - m;
+    return std::string_view::npos;
+  }
+  const std::size_t words = (m + 63) / 64;
+  std::vector<std::uint64_t> state(words, 0);
+  for (std::size_t i = offset; i < end; i++) {
+    advance(state);
+    const std::uint64_t* mask =
+      &this->masks[static_cast<unsigned char>(s[i]) * words];
+    for (std::size_t w = 0; w < words; w++)
+      state[w] &= mask[w];
+    if (state[words - 1] & accept)
+      return i + 1 - m;
+  }
+  return std::string_view::npos;
+}
+
+/**
+ * @brief Segment Match
+ *
+ * Matches a single segment: the first and last pieces are anchored to the
+ * ends of the subject and each middle piece is taken at its leftmost
+ * occurrence after the previous one
+ *
+ * @param s The subject
+ *
+ * @return `true` on a match, otherwise `false`
+ */
+bool Glob::Segment::match(std::string_view s) const {
+  const Piece& first = this->pieces.front();
+  const Piece& last  = this->pieces.back();
+  if (this->pieces.size() == 1)
+    return s.length() == first.bytes.length() && first.at(s, 0);
+  if (s.length() < first.bytes.length() + last.bytes.length() ||
+      !first.at(s, 0) || !last.at(s, s.length() - last.bytes.length()))
+    return false;
+  std::size_t offset = first.bytes.length();
+  const std::size_t end = s.length() - last.bytes.length();
+  for (std::size_t i = 1; i + 1 < this->pieces.size(); i++) {
+    std::size_t found = this->pieces[i].find(s, offset, end);
+    if (found == std::string_view::npos)
+      return false;
+    offset = found + this->pieces[i].bytes.length();
+  }
+  return true;
+}
+
+/**
+ * @brief Run At
+ *
+ * Determines whether a run of segment patterns matches consecutive path
+ * segments starting at a given offset
+ *
+ * @return `true` on a match, otherwise `false`
+ */
+bool Glob::run_at(const std::vector<Segment>& run,
+    const std::vector<std::string_view>& segments, std::size_t offset) {
+  if (offset + run.size() > segments.size())
+    return false;
+  for (std::size_t i = 0; i < run.size(); i++)
+    if (!run[i].match(segments[offset + i]))
+      return false;
+  return true;
+}
+
+/**
+ * @brief Find Run
+ *
+ * Finds the leftmost offset within `[offset, end)` at which a run of segment
+ * patterns matches consecutive path segments, in a single pass using
+ * Shift-And over segments
+ *
+ * @remarks A segment is only tested against the patterns that would extend
+ * a partial match, so each (segment, pattern) pair is tested at most once.
+ *
+ * @return Offset of the match, or `std::string_view::npos`
+ */
+std::size_t Glob::find_run(const std::vector<Segment>& run,
+    const std::vector<std::string_view>& segments, std::size_t offset,
+    std::size_t end) {
+  const std::size_t r = run.size();
+  if (r == 0)
+    return offset;
+  if (offset > end || end - offset < r)
+    return std::string_view::npos;
+  std::vector<std::uint64_t> state((r + 63) / 64, 0);
+  for (std::size_t j = offset; j < end; j++) {
+    advance(state);
+    for (std::size_t w = 0; w < state.size(); w++)
+      for (std::uint64_t bits = state[w]; bits != 0; bits &= bits - 1) {
+        const std::size_t bit = static_cast<std::size_t>(
+          __builtin_ctzll(bits));
+        if (w * 64 + bit >= r || !run[w * 64 + bit].match(segments[j]))
+          state[w] &= ~(std::uint64_t{1} << bit);
+      }
+    if ((state[(r - 1) / 64] >> ((r - 1) % 64)) & 1)
+      return j + 1 - r;
+  }
+  return std::string_view::npos;
+}
+
+/**
+ * @brief Match
+ *
+ * Matches a subject against the compiled pattern
+ *
+ * @param s The subject (a single segment, or a whole path in path mode)
+ *
+ * @return `true` on a match, otherwise `false`
+ */
+bool Glob::match(std::string_view s) const {
+  if (!this->path)
+    return this->runs.front().front().match(s);
+
+  // Apply the same anchored, leftmost strategy to runs of whole segments
+  const std::vector<std::string_view> segments = Utility::explode_view(s, "/");
+  const std::vector<Segment>& first = this->runs.front();
+  const std::vector<Segment>& last  = this->runs.back();
+  if (this->runs.size() == 1)
+    return segments.size() == first.size() && Glob::run_at(first, segments, 0);
+  if (segments.size() < first.size() + last.size() ||
+      !Glob::run_at(first, segments, 0) ||
+      !Glob::run_at(last, segments, segments.size() - last.size()))
+    return false;
+  std::size_t offset = first.size();
+  const std::size_t end = segments.size() - last.size();
+  for (std::size_t i = 1; i + 1 < this->runs.size(); i++) {
+    const std::vector<Segment>& run = this->runs[i];
+    std::size_t found = Glob::find_run(run, segments, offset, end);
+    if (found == std::string_view::npos)
+      return false;
+    offset = found + run.size();
+  }
+  return true;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file  Glob.hpp
+ * @brief Glob
+ *
+ * Class definition for Glob
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _GLOB_HPP
+#define _GLOB_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Glob {
+  private:
+    struct Piece {
+      std::string                bytes;
+      std::vector<bool>          any;
+      std::vector<std::uint64_t> masks;
+      bool                       literal = true;
+      bool at(std::string_view s, std::size_t offset) const;
+      std::size_t find(std::string_view s, std::size_t offset,
+        std::size_t end) const;
+    };
+    struct Segment {
+      // Pieces separated by `*`; a single piece means no `*` at all
+      std::vector<Piece> pieces;
+      bool match(std::string_view s) const;
+    };
+    // Runs of segment patterns separated by `**` (a single run in segment
+    // mode, where it holds exactly one segment pattern)
+    std::vector<std::vector<Segment>> runs;
+    bool                              path;
+    static Segment compile(std::string_view pattern);
+    static bool run_at(const std::vector<Segment>& run,
+      const std::vector<std::string_view>& segments, std::size_t offset);
+    static std::size_t find_run(const std::vector<Segment>& run,
+      const std::vector<std::string_view>& segments, std::size_t offset,
+      std::size_t end);
+  public:
+    Glob(std::string_view pattern, bool path = false);
+    bool match(std::string_view s) const;
+};
+
+#endif
@@ -0,0 +1,238 @@
+/**
+ * @file  HyperLogLog.cpp
+ * @brief HyperLogLog
+ *
+ * Class implementation for HyperLogLog
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "Address.hpp"
+#include "HyperLogLog.hpp"
+#include "Utility.hpp"
+
+namespace {
+  // Serialized form: magic, version, precision, then one byte per register
+  const char         magic[4] = {'U', 'H', 'L', 'L'};
+  const std::uint8_t version  = 1;
+  const std::size_t  header   = sizeof(magic) + 2;
+
+  // Helper functions of Ertl's improved raw estimator
+  double sigma(double x) {
+    if (x == 1)
+      return std::numeric_limits<double>::infinity();
+    double y = 1, z = x, previous;
+    do {
+      x *= x;
+      previous = z;
+      z += x * y;
+      y += y;
+    } while (z != previous);
+    return z;
+  }
+
+  double tau(double x) {
+    if (x == 0 || x == 1)
+      return 0;
+    double y = 1, z = 1 - x, previous;
+    do {
+      x = std::sqrt(x);
+      previous = z;
+      y *= 0.5;
+      z -= (1 - x) * (1 - x) * y;
+    } while (z != previous);
+    return z / 3;
+  }
+}
+
+/**
+ * @brief HyperLogLog
+ *
+ * Prepares an empty sketch of `2^precision` one-byte registers, giving a
+ * relative standard error of about `1.04 / sqrt(2^precision)` (0.8% and
+ * 16 KiB at the default precision)
+ *
+ * @param precision The number of index bits, from 4 to 18
+ *
+ * @throws `std::invalid_argument` if the precision is out of range
+ */
+HyperLogLog::HyperLogLog(std::uint8_t precision): precision{precision} {
+  if (precision < 4 || precision > 18)
+    throw std::invalid_argument{"The precision must be between 4 and 18."};
+  this->registers.assign(std::size_t{1} << precision, 0);
+}
+
+/**
+ * @brief Add
+ *
+ * Adds an address (without its port) to the sketch
+ *
+ * @param a The Address to add
+ */
+void HyperLogLog::add(const Address& a) {
+  this->add(std::string_view{reinterpret_cast<const char*>(a.bytes),
+    a.length()});
+}
+
+/**
+ * @brief Add
+ *
+ * Adds an arbitrary key to the sketch
+ *
+ * @param s The key to add
+ */
+void HyperLogLog::add(std::string_view s) {
+  this->add_hash(Utility::hash(s));
+}
+
+/**
+ * @brief Add Hash
+ *
+ * Adds a precomputed, well mixed 64-bit hash to the sketch
+ *
+ * @param h The hash (e.g. from `Utility::hash`)
+ */
+void HyperLogLog::add_hash(std::uint64_t h) {
+  const unsigned    q = 64 - this->precision;
+  const std::size_t i = static_cast<std::size_t>(h >> q);
+  const std::uint64_t w = h << this->precision;
+  const std::uint8_t rank = static_cast<std::uint8_t>(
+    w == 0 ? q + 1 : __builtin_clzll(w) + 1);
+  if (rank > this->registers[i])
+    this->registers[i] = rank;
+}
+
+/**
+ * @brief Clear
+ *
+ * Empties the sketch, keeping its precision
+ */
+void HyperLogLog::clear() {
+  std::fill(this->registers.begin(), this->registers.end(), 0);
+}
+
+/**
+ * @brief Estimate
+ *
+ * Estimates the number of distinct keys added, using Ertl's improved raw
+ * estimator over the register histogram
+ *
+ * @remarks Unlike the original HyperLogLog and HLL++ estimators, this needs
+ * neither a small-range linear counting switch nor empirical bias tables,
+ * and stays unbiased across the whole range.
+ *
+ * @return The estimated cardinality
+ */
+double HyperLogLog::estimate() const {
+  const unsigned q = 64 - this->precision;
+  const double   m = static_cast<double>(this->registers.size());
+  std::size_t histogram[66] = {};
+  for (std::uint8_t r : this->registers)
+    histogram[r]++;
+  double z = m * tau(1 - static_cast<double>(histogram[q + 1]) / m);
+  for (unsigned k = q; k >= 1; k--)
+    z = 0.5 * (z + static_cast<double>(histogram[k]));
+  z += m * sigma(static_cast<double>(histogram[0]) / m);
+  return m * m / (2 * std::log(2.0) * z);
+}
+
+/**
+ * @brief Merge
+ *
+ * Folds another sketch into this one, so that it estimates the union
+ *
+ * @param other The HyperLogLog to merge
+ *
+ * @throws `std::invalid_argument` if the precisions differ
+ */
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other.precision != this->precision)
+    throw std::invalid_argument{"Could not merge sketches of different "
+      "precision."};
+  std::uint8_t*       p = this->registers.data();
+  const std::uint8_t* o = other.registers.data();
+  const std::size_t   n = this->registers.size();
+  std::size_t i = 0;
+#ifdef __SSE2__
+  // Registers come in multiples of 16, so the vector loop covers them all
+  for (; i + 16 <= n; i += 16) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(o + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_max_epu8(a, b));
+  }
+#endif
+  for (; i < n; i++)
+    p[i] = std::max(p[i], o[i]);
+}
+
+/**
+ * @brief Serialize
+ *
+ * Encodes the sketch in a versioned, platform independent binary form that
+ * can be stored and later merged
+ *
+ * @return std::string containing the encoded sketch
+ */
+std::string HyperLogLog::serialize() const {
+  std::string result;
+  result.reserve(header + this->registers.size());
+  result.append(magic, sizeof(magic));
+  result.push_back(static_cast<char>(version));
+  result.push_back(static_cast<char>(this->precision));
+  result.append(reinterpret_cast<const char*>(this->registers.data()),
+    this->registers.size());
+  return result;
+}
+
+/**
+ * @brief Size
+ *
+ * @return The number of registers (one byte each)
+ */
+std::size_t HyperLogLog::size() const {
+  return this->registers.size();
+}
+
+/**
+ * @brief Deserialize
+ *
+ * Decodes a sketch produced by `serialize()`
+ *
+ * @param data The encoded sketch
+ *
+ * @throws `std::runtime_error` if the data is not a valid sketch
+ *
+ * @return The decoded HyperLogLog
+ */
+HyperLogLog HyperLogLog::deserialize(std::string_view data) {
+  if (data.length() < header || memcmp(data.data(), magic, sizeof(magic)) ||
+      static_cast<std::uint8_t>(data[4]) != version)
+    throw std::runtime_error{"Could not decode the sketch header."};
+  const std::uint8_t precision = static_cast<std::uint8_t>(data[5]);
+  if (precision < 4 || precision > 18 ||
+      data.length() != header + (std::size_t{1} << precision))
+    throw std::runtime_error{"Could not decode the sketch registers."};
+  HyperLogLog result{precision};
+  const unsigned limit = 64u - precision + 1;
+  for (std::size_t i = 0; i < result.registers.size(); i++) {
+    const std::uint8_t r = static_cast<std::uint8_t>(data[header + i]);
+    if (r > limit)
+      throw std::runtime_error{"Could not decode the sketch registers."};
+    result.registers[i] = r;
+  }
+  return result;
+}
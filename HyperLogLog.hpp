@@ -0,0 +1,40 @@
+/**
+ * @file  HyperLogLog.hpp
+ * @brief HyperLogLog
+ *
+ * Class definition for HyperLogLog
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _HYPERLOGLOG_HPP
+#define _HYPERLOGLOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Address.hpp"
+
+class HyperLogLog {
+  private:
+    std::uint8_t              precision;
+    std::vector<std::uint8_t> registers;
+
+  public:
+    HyperLogLog(std::uint8_t precision = 14);
+    void add(const Address& a);
+    void add(std::string_view s);
+    void add_hash(std::uint64_t h);
+    void clear();
+    double estimate() const;
+    void merge(const HyperLogLog& other);
+    std::string serialize() const;
+    std::size_t size() const;
+
+    static HyperLogLog deserialize(std::string_view data);
+};
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * @file  KeyValueParser.cpp
+ * @brief KeyValueParser
+ *
+ * Class implementation for KeyValueParser
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "KeyValueParser.hpp"
+
+namespace {
+  // Byte classes used to scan each line once
+  enum : unsigned char {
+    separator = 1,
+    assignment = 2,
+    quote = 4,
+    comment = 8,
+    whitespace = 16
+  };
+}
+
+/**
+ * @brief KeyValueParser
+ *
+ * Prepares a parser for records of `key=value` pairs such as metrics line
+ * protocol (`name,tag=a field=1 ts`) or `.ini` style configuration lines
+ *
+ * @param separators Bytes separating pairs (any one of them ends a pair)
+ * @param assign     Byte separating a key from its value
+ * @param comments   Bytes that mark a whole line as a comment when they are
+ *                   its first non-whitespace byte
+ */
+KeyValueParser::KeyValueParser(std::string_view separators, char assign,
+    std::string_view comments): assign{assign} {
+  for (unsigned char c : std::string_view{" \t\r"})
+    this->classes[c] |= whitespace;
+  for (unsigned char c : separators)
+    this->classes[c] |= separator;
+  for (unsigned char c : comments)
+    this->classes[c] |= comment;
+  this->classes[static_cast<unsigned char>(assign)] |= assignment;
+  this->classes[static_cast<unsigned char>('"')]    |= quote;
+}
+
+/**
+ * @brief Each
+ *
+ * Scans one line, invoking a callback with each pair as views into the line
+ *
+ * @remarks Separators and the assignment byte have no effect between double
+ * quotes, and a value quoted in its entirety is returned without the quotes
+ * (escapes inside are left as they are). Keys and values are trimmed of
+ * spaces, tabs and carriage returns, and whitespace separators next to the
+ * assignment byte are skipped, so `key = value` is a single pair. A pair
+ * without the assignment byte has an empty value.
+ *
+ * @param line The line to scan
+ * @param f    Callback invoked with each Pair
+ *
+ * @return `false` if the line is blank or a comment, otherwise `true`
+ */
+template <typename F>
+bool KeyValueParser::each(std::string_view line, F f) const {
+  auto is = [this](char c, unsigned char mask) {
+    return (this->classes[static_cast<unsigned char>(c)] & mask) != 0;
+  };
+  auto trim = [&is](std::string_view v) {
+    while (v.length() > 0 && is(v.front(), whitespace))
+      v.remove_prefix(1);
+    while (v.length() > 0 && is(v.back(), whitespace))
+      v.remove_suffix(1);
+    return v;
+  };
+
+  std::size_t i = 0;
+  while (i < line.length() && is(line[i], whitespace))
+    i++;
+  if (i == line.length() || is(line[i], comment))
+    return false;
+
+  while (i < line.length()) {
+    while (i < line.length() && is(line[i], separator))
+      i++;
+    if (i == line.length())
+      break;
+    // Scan to the end of this pair, noting the first assignment byte
+    std::size_t start = i, eq = std::string_view::npos;
+    bool quoted = false;
+    for (; i < line.length(); i++) {
+      char c = line[i];
+      if (!is(c, separator | assignment | quote))
+        continue;
+      if (is(c, quote))
+        quoted = !quoted;
+      else if (quoted)
+        continue;
+      else if (is(c, separator)) {
+        // Whitespace around the assignment byte does not end the pair
+        std::size_t next = i;
+        while (next < line.length() && is(line[next], whitespace))
+          next++;
+        if (next == i || !((eq == std::string_view::npos &&
+            next < line.length() && is(line[next], assignment)) ||
+            (eq != std::string_view::npos && trim(line.substr(eq + 1,
+            i - eq - 1)).length() == 0)))
+          break;
+        i = next - 1;
+      }
+      else if (eq == std::string_view::npos)
+        eq = i;
+    }
+    std::string_view pair = line.substr(start, i - start);
+    Pair result;
+    if (eq == std::string_view::npos)
+      result.key = trim(pair);
+    else {
+      result.key   = trim(pair.substr(0, eq - start));
+      result.value = trim(pair.substr(eq - start + 1));
+      if (result.value.length() >= 2 && result.value.front() == '"' &&
+          result.value.back() == '"')
+        result.value = result.value.substr(1, result.value.length() - 2);
+    }
+    f(result);
+  }
+  return true;
+}
+
+/**
+ * @brief Parse
+ *
+ * Parses one line into pairs of views into the line
+ *
+ * @param line The line to parse
+ *
+ * @return std::vector of Pair (empty for blank and comment lines)
+ */
+std::vector<KeyValueParser::Pair> KeyValueParser::parse(
+    std::string_view line) const {
+  std::vector<Pair> result;
+  this->each(line, [&result](const Pair& pair) {
+    result.push_back(pair);
+  });
+  return result;
+}
+
+/**
+ * @brief Parse Batch
+ *
+ * Parses a whole buffer of lines into columns of keys and values, skipping
+ * blank and comment lines
+ *
+ * @param buffer The buffer to parse
+ * @param line   The byte separating lines
+ *
+ * @return Columns of views into `buffer`, one record per parsed line
+ */
+KeyValueParser::Columns KeyValueParser::parse_batch(std::string_view buffer,
+    char line) const {
+  Columns result;
+  // Guess the column sizes from the first line to limit reallocation
+  std::size_t first = buffer.find(line);
+  if (first != std::string_view::npos && first > 0) {
+    std::size_t pairs = 0;
+    this->each(buffer.substr(0, first), [&pairs](const Pair&) { pairs++; });
+    std::size_t lines = buffer.length() / (first + 1) + 1;
+    result.keys.reserve(lines * pairs);
+    result.values.reserve(lines * pairs);
+    result.offsets.reserve(lines + 1);
+  }
+
+  for (std::size_t lpos = 0; lpos <= buffer.length();) {
+    std::size_t lend = buffer.find(line, lpos);
+    if (lend == std::string_view::npos)
+      lend = buffer.length();
+    if (this->each(buffer.substr(lpos, lend - lpos), [&result](
+        const Pair& pair) {
+      result.keys.push_back(pair.key);
+      result.values.push_back(pair.value);
+    }))
+      result.offsets.push_back(result.keys.size());
+    lpos = lend + 1;
+  }
+  return result;
+}
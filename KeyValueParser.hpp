@@ -0,0 +1,44 @@
+/**
+ * @file  KeyValueParser.hpp
+ * @brief KeyValueParser
+ *
+ * Class definition for KeyValueParser
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _KEYVALUEPARSER_HPP
+#define _KEYVALUEPARSER_HPP
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+class KeyValueParser {
+  public:
+    struct Pair {
+      std::string_view key;
+      std::string_view value;
+    };
+    struct Columns {
+      std::vector<std::string_view> keys;
+      std::vector<std::string_view> values;
+      // Record `i` holds the pairs in `[offsets[i], offsets[i + 1])`
+      std::vector<std::size_t>      offsets{0};
+      std::size_t size() const { return this->offsets.size() - 1; }
+    };
+  private:
+    std::array<unsigned char, 256> classes{};
+    char                           assign;
+    template <typename F>
+    bool each(std::string_view line, F f) const;
+  public:
+    KeyValueParser(std::string_view separators = ", ", char assign = '=',
+      std::string_view comments = "#;");
+    std::vector<Pair> parse(std::string_view line) const;
+    Columns parse_batch(std::string_view buffer, char line = '\n') const;
+};
+
+#endif
@@ -0,0 +1,168 @@
+/**
+ * @file  Listener.cpp
+ * @brief Listener
+ *
+ * Class implementation for Listener
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <linux/filter.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+#include "Listener.hpp"
+
+namespace {
+  // Closes every descriptor in `fds` without disturbing errno
+  void close_all(const std::vector<int>& fds) {
+    const int saved = errno;
+    for (int fd : fds)
+      ::close(fd);
+    errno = saved;
+  }
+
+  void option(int fd, int level, int name, int value, const char* what) {
+    if (setsockopt(fd, level, name, &value, sizeof(value)) != 0)
+      throw std::runtime_error{std::string{"Could not set "} + what + "."};
+  }
+}
+
+/**
+ * @brief Open
+ *
+ * Creates `count` listening TCP sockets sharing one address through
+ * SO_REUSEPORT, using the default Options
+ *
+ * @param address The local address, as returned by `Utility::parse_addr`
+ * @param count   The number of sockets (typically one per worker thread)
+ *
+ * @throws `std::runtime_error` if a socket cannot be created or bound
+ *
+ * @return The listening socket descriptors, owned by the caller
+ */
+std::vector<int> Listener::open(const struct sockaddr_storage& address,
+    std::size_t count) {
+  return Listener::open(address, count, Options{});
+}
+
+/**
+ * @brief Open
+ *
+ * Creates `count` sockets sharing one address through SO_REUSEPORT so that
+ * the kernel spreads new connections (or datagrams) across them, with no
+ * shared accept lock between workers
+ *
+ * @remarks When the address has port zero, the first socket's ephemeral port
+ * is reused for the rest. IPv6 sockets set IPV6_V6ONLY explicitly from
+ * `v6only` (on by default), so a listener on "::" accepts IPv4 clients only
+ * when it is cleared, regardless of the system default. With `steer` set, a
+ * classic BPF program maps each connection to socket `cpu % count`, which
+ * keeps it on the CPU that took the interrupt provided worker `i` is pinned
+ * to CPU `i`.
+ *
+ * @param address The local address, as returned by `Utility::parse_addr`
+ * @param count   The number of sockets (typically one per worker thread)
+ * @param options Socket type and options
+ *
+ * @throws `std::invalid_argument` if `count` is zero or the address family is
+ * not AF_INET or AF_INET6
+ * @throws `std::runtime_error` if a socket cannot be created, configured or
+ * bound; any sockets already created are closed
+ *
+ * @return The socket descriptors, owned by the caller
+ */
+std::vector<int> Listener::open(const struct sockaddr_storage& address,
+    std::size_t count, const Options& options) {
+  if (count == 0)
+    throw std::invalid_argument{"At least one socket must be requested."};
+  if (address.ss_family != AF_INET && address.ss_family != AF_INET6)
+    throw std::invalid_argument{"Unexpected address family."};
+  struct sockaddr_storage local = address;
+  const socklen_t length = address.ss_family == AF_INET ?
+    sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6);
+  const bool stream = options.type == SOCK_STREAM;
+
+  std::vector<int> fds;
+  fds.reserve(count);
+  try {
+    for (std::size_t i = 0; i < count; i++) {
+      const int fd = ::socket(local.ss_family, options.type | SOCK_CLOEXEC |
+        (options.nonblocking ? SOCK_NONBLOCK : 0), 0);
+      if (fd < 0)
+        throw std::runtime_error{"Could not create the socket."};
+      fds.push_back(fd);
+      option(fd, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR");
+      option(fd, SOL_SOCKET, SO_REUSEPORT, 1, "SO_REUSEPORT");
+      if (local.ss_family == AF_INET6)
+        option(fd, IPPROTO_IPV6, IPV6_V6ONLY, options.v6only ? 1 : 0,
+          "IPV6_V6ONLY");
+      if (stream && options.defer_accept > 0)
+        option(fd, IPPROTO_TCP, TCP_DEFER_ACCEPT, options.defer_accept,
+          "TCP_DEFER_ACCEPT");
+      if (stream && options.fastopen > 0)
+        option(fd, IPPROTO_TCP, TCP_FASTOPEN, options.fastopen,
+          "TCP_FASTOPEN");
+      if (::bind(fd, reinterpret_cast<const struct sockaddr*>(&local),
+          length) != 0)
+        throw std::runtime_error{"Could not bind the socket."};
+      if (stream && ::listen(fd, options.backlog) != 0)
+        throw std::runtime_error{"Could not listen on the socket."};
+      if (i == 0) {
+        // Bind the remaining sockets to the same (possibly ephemeral) port
+        socklen_t size = sizeof(local);
+        if (getsockname(fd, reinterpret_cast<struct sockaddr*>(&local),
+            &size) != 0)
+          throw std::runtime_error{"Could not read the bound address."};
+      }
+    }
+    if (options.steer)
+      Listener::steer(fds.front(), count);
+  } catch (...) {
+    close_all(fds);
+    throw;
+  }
+  return fds;
+}
+
+/**
+ * @brief Steer
+ *
+ * Attaches a classic BPF program to a SO_REUSEPORT group selecting the
+ * socket at index `cpu % count`
+ *
+ * @param fd    Any socket in the group
+ * @param count The number of sockets in the group
+ *
+ * @throws `std::runtime_error` if the program cannot be attached
+ */
+void Listener::steer(int fd, std::size_t count) {
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+  struct sock_filter code[] = {
+    // A = current CPU
+    {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+      static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+    // A = A % count
+    {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(count)},
+    // Return A as the socket index
+    {BPF_RET | BPF_A, 0, 0, 0}
+  };
+  struct sock_fprog program = {
+    static_cast<unsigned short>(sizeof(code) / sizeof(code[0])), code
+  };
+  if (setsockopt(fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program,
+      sizeof(program)) != 0)
+    throw std::runtime_error{"Could not attach the steering program."};
+#else
+  (void)fd, (void)count;
+  throw std::runtime_error{"Socket steering is not available."};
+#endif
+}
@@ -0,0 +1,47 @@
+/**
+ * @file  Listener.hpp
+ * @brief Listener
+ *
+ * Class definition for Listener
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _LISTENER_HPP
+#define _LISTENER_HPP
+
+#include <cstddef>
+#include <sys/socket.h>
+#include <vector>
+
+class Listener {
+  public:
+    struct Options {
+      // SOCK_STREAM or SOCK_DGRAM
+      int  type         = SOCK_STREAM;
+      int  backlog      = SOMAXCONN;
+      // Seconds to wait for data before waking accept(), zero to disable
+      int  defer_accept = 0;
+      // Pending TCP Fast Open queue length, zero to disable
+      int  fastopen     = 0;
+      bool nonblocking  = false;
+      // Accept only IPv6 on IPv6 sockets, so "::" does not also take IPv4
+      bool v6only       = true;
+      // Steer each connection to the socket matching the receiving CPU
+      bool steer        = false;
+    };
+
+  private:
+    Listener() {}
+
+    static void steer(int fd, std::size_t count);
+
+  public:
+    static std::vector<int> open(const struct sockaddr_storage& address,
+      std::size_t count);
+    static std::vector<int> open(const struct sockaddr_storage& address,
+      std::size_t count, const Options& options);
+};
+
+#endif
@@ -0,0 +1,167 @@
+/**
+ * @file  PortSet.cpp
+ * @brief PortSet
+ *
+ * Class implementation for PortSet
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "PortSet.hpp"
+
+namespace {
+  // Parses a decimal port number, ignoring surrounding spaces and tabs
+  bool number(std::string_view s, std::uint16_t& out) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+      s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+      s.remove_suffix(1);
+    if (s.empty() || s.length() > 5)
+      return false;
+    std::uint32_t value = 0;
+    for (char c : s) {
+      if (c < '0' || c > '9')
+        return false;
+      value = value * 10 + static_cast<std::uint32_t>(c - '0');
+    }
+    if (value > 65535)
+      return false;
+    out = static_cast<std::uint16_t>(value);
+    return true;
+  }
+}
+
+/**
+ * @brief Port Set
+ *
+ * Builds a set from a port specification such as "80,443,8000-8100"
+ *
+ * @param spec The port specification
+ *
+ * @throws `std::runtime_error` if the specification cannot be parsed
+ */
+PortSet::PortSet(std::string_view spec) {
+  if (!PortSet::parse(spec, *this))
+    throw std::runtime_error{"Could not parse the provided port list."};
+}
+
+/**
+ * @brief Add
+ *
+ * Adds an inclusive range of ports to the set, a word at a time
+ *
+ * @param first The first port in the range
+ * @param last  The last port in the range (ignored if less than `first`)
+ */
+void PortSet::add(std::uint16_t first, std::uint16_t last) {
+  if (last < first)
+    return;
+  const std::size_t a = first >> 6, b = last >> 6;
+  const std::uint64_t head = ~std::uint64_t{0} << (first & 63);
+  const std::uint64_t tail = ~std::uint64_t{0} >> (63 - (last & 63));
+  if (a == b) {
+    this->words[a] |= head & tail;
+    return;
+  }
+  this->words[a] |= head;
+  for (std::size_t i = a + 1; i < b; i++)
+    this->words[i] = ~std::uint64_t{0};
+  this->words[b] |= tail;
+}
+
+/**
+ * @brief Empty
+ *
+ * @return `true` if the set contains no ports
+ */
+bool PortSet::empty() const {
+  for (std::uint64_t word : this->words)
+    if (word != 0)
+      return false;
+  return true;
+}
+
+/**
+ * @brief Ranges
+ *
+ * Lists the set as sorted, disjoint and non-adjacent inclusive ranges
+ *
+ * @return std::vector of port ranges
+ */
+std::vector<PortSet::Range> PortSet::ranges() const {
+  std::vector<Range> result;
+  bool open = false;
+  std::uint32_t first = 0;
+  for (std::size_t i = 0; i < this->words.size(); i++) {
+    std::uint64_t word = this->words[i];
+    const std::uint32_t base = static_cast<std::uint32_t>(i * 64);
+    std::uint32_t bit = 0;
+    // Alternate between finding the next set and the next clear bit
+    while (bit < 64) {
+      const std::uint64_t rest = (open ? ~word : word) >> bit;
+      if (rest == 0)
+        break;
+      bit += static_cast<std::uint32_t>(__builtin_ctzll(rest));
+      if (open)
+        result.emplace_back(static_cast<std::uint16_t>(first),
+          static_cast<std::uint16_t>(base + bit - 1));
+      else
+        first = base + bit;
+      open = !open;
+    }
+  }
+  if (open)
+    result.emplace_back(static_cast<std::uint16_t>(first), 65535);
+  return result;
+}
+
+/**
+ * @brief Size
+ *
+ * @return The number of ports in the set
+ */
+std::size_t PortSet::size() const {
+  std::size_t result = 0;
+  for (std::uint64_t word : this->words)
+    result += static_cast<std::size_t>(__builtin_popcountll(word));
+  return result;
+}
+
+/**
+ * @brief Parse
+ *
+ * Parses a comma-separated list of ports and inclusive ranges (for example
+ * "80, 443, 8000-8100") into a set, without allocating or throwing
+ *
+ * @param      spec The port specification
+ * @param[out] out  Storage for the parsed PortSet
+ *
+ * @return `true` on success, otherwise `false` (an empty entry, a reversed
+ * range or a number outside 0-65535 is an error)
+ */
+bool PortSet::parse(std::string_view spec, PortSet& out) {
+  out = PortSet{};
+  while (true) {
+    const std::size_t comma = spec.find(',');
+    const std::string_view item = spec.substr(0, comma);
+    const std::size_t dash = item.find('-');
+    std::uint16_t first, last;
+    if (!number(item.substr(0, dash), first))
+      return false;
+    if (dash == std::string_view::npos)
+      last = first;
+    else if (!number(item.substr(dash + 1), last) || last < first)
+      return false;
+    out.add(first, last);
+    if (comma == std::string_view::npos)
+      return true;
+    spec.remove_prefix(comma + 1);
+  }
+}
@@ -0,0 +1,44 @@
+/**
+ * @file  PortSet.hpp
+ * @brief PortSet
+ *
+ * Class definition for PortSet
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _PORTSET_HPP
+#define _PORTSET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class PortSet {
+  public:
+    // Inclusive range of ports
+    typedef std::pair<std::uint16_t, std::uint16_t> Range;
+
+  private:
+    // One bit per port, port `p` at bit `p % 64` of word `p / 64`
+    std::array<std::uint64_t, 1024> words{};
+
+  public:
+    PortSet() {}
+    PortSet(std::string_view spec);
+    void add(std::uint16_t first, std::uint16_t last);
+    bool contains(std::uint16_t port) const {
+      return this->words[port >> 6] >> (port & 63) & 1;
+    }
+    bool empty() const;
+    std::vector<Range> ranges() const;
+    std::size_t size() const;
+
+    static bool parse(std::string_view spec, PortSet& out);
+};
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * @file  Prefix.cpp
+ * @brief Prefix
+ *
+ * Class implementation for Prefix
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "Address.hpp"
+#include "Prefix.hpp"
+
+/**
+ * @brief Prefix
+ *
+ * Constructs a CIDR prefix, clearing any host bits of the address beyond the
+ * prefix length (and the port)
+ *
+ * @param address The network address
+ * @param length  The prefix length, clamped to the width of the family
+ */
+Prefix::Prefix(const Address& address, std::uint8_t length):
+    address{address}, length{length} {
+  const std::size_t bits = this->address.length() * 8;
+  if (this->length > bits)
+    this->length = static_cast<std::uint8_t>(bits);
+  this->address.port = 0;
+  for (std::size_t i = 0; i < 16; i++) {
+    std::size_t keep = this->length > i * 8 ?
+      std::min<std::size_t>(8, this->length - i * 8) : 0;
+    this->address.bytes[i] &= static_cast<std::uint8_t>(0xff00 >> keep);
+  }
+}
+
+/**
+ * @brief Equality
+ *
+ * @param other The Prefix to compare with
+ *
+ * @return `true` if both the network and length are equal
+ */
+bool Prefix::operator==(const Prefix& other) const {
+  return this->length == other.length && this->address == other.address;
+}
+
+/**
+ * @brief Contains
+ *
+ * Determines whether an address lies within this prefix
+ *
+ * @param a The Address to test
+ *
+ * @return `true` if `a` has the same family and network bits
+ */
+bool Prefix::contains(const Address& a) const {
+  if (a.family != this->address.family)
+    return false;
+  std::size_t full = this->length / 8, rest = this->length % 8;
+  if (memcmp(a.bytes, this->address.bytes, full) != 0)
+    return false;
+  return rest == 0 || ((a.bytes[full] ^ this->address.bytes[full]) &
+    (0xff00 >> rest) & 0xff) == 0;
+}
+
+/**
+ * @brief First
+ *
+ * @return The lowest Address in the prefix
+ */
+Address Prefix::first() const {
+  return this->address;
+}
+
+/**
+ * @brief Last
+ *
+ * @return The highest Address in the prefix
+ */
+Address Prefix::last() const {
+  Address result = this->address;
+  for (std::size_t i = 0; i < result.length(); i++) {
+    std::size_t keep = this->length > i * 8 ?
+      std::min<std::size_t>(8, this->length - i * 8) : 0;
+    result.bytes[i] |= static_cast<std::uint8_t>(0xff >> keep);
+  }
+  return result;
+}
+
+/**
+ * @brief String
+ *
+ * Formats the prefix in CIDR notation (e.g. `10.0.0.0/8`)
+ *
+ * @return std::string representation, or empty if the family is unset
+ */
+std::string Prefix::str() const {
+  char buffer[INET6_ADDRSTRLEN];
+  if (this->address.family == 0 || inet_ntop(this->address.family,
+      this->address.bytes, buffer, sizeof(buffer)) == nullptr)
+    return {};
+  return std::string{buffer} + "/" + std::to_string(this->length);
+}
+
+/**
+ * @brief Parse
+ *
+ * Parses CIDR notation (`addr/len`) or a bare address (a full-length prefix)
+ * without throwing
+ *
+ * @param      s   The text to parse
+ * @param[out] out Storage for the parsed Prefix, with host bits cleared
+ *
+ * @return `true` on success, otherwise `false`
+ */
+bool Prefix::parse(std::string_view s, Prefix& out) {
+  Address address;
+  std::size_t slash = s.find('/');
+  if (!Address::parse(s.substr(0, slash), address))
+    return false;
+  unsigned length = static_cast<unsigned>(address.length() * 8);
+  if (slash != std::string_view::npos) {
+    std::string_view digits = s.substr(slash + 1);
+    if (digits.length() == 0 || digits.length() > 3)
+      return false;
+    unsigned value = 0;
+    for (char c : digits)
+      if (c < '0' || c > '9')
+        return false;
+      else
+        value = value * 10 + static_cast<unsigned>(c - '0');
+    if (value > length)
+      return false;
+    length = value;
+  }
+  out = Prefix{address, static_cast<std::uint8_t>(length)};
+  return true;
+}
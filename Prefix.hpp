@@ -0,0 +1,35 @@
+/**
+ * @file  Prefix.hpp
+ * @brief Prefix
+ *
+ * Class definition for Prefix
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _PREFIX_HPP
+#define _PREFIX_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "Address.hpp"
+
+class Prefix {
+  public:
+    Address      address;
+    std::uint8_t length = 0;
+
+    Prefix() {}
+    Prefix(const Address& address, std::uint8_t length);
+    bool operator==(const Prefix& other) const;
+    bool contains(const Address& a) const;
+    Address first() const;
+    Address last() const;
+    std::string str() const;
+
+    static bool parse(std::string_view s, Prefix& out);
+};
+
+#endif
@@ -0,0 +1,351 @@
+/**
+ * @file  PrefixTable.cpp
+ * @brief PrefixTable
+ *
+ * Class implementation for PrefixTable
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include "Address.hpp"
+#include "Prefix.hpp"
+#include "PrefixTable.hpp"
+
+namespace {
+  // Addresses as big-endian integers while building (a compiler extension,
+  // so it stays out of the header)
+  typedef unsigned __int128 Value;
+
+  Value integer(const Address& a) {
+    Value result = 0;
+    for (std::size_t i = 0; i < a.length(); i++)
+      result = result << 8 | a.bytes[i];
+    return result;
+  }
+
+  void unpack(Value v, std::uint8_t (&out)[16]) {
+    for (std::size_t i = 16; i > 0; i--, v >>= 8)
+      out[i - 1] = static_cast<std::uint8_t>(v);
+  }
+
+  // Serialized form: this header followed by the IPv4 and IPv6 range arrays
+  // at 8-byte aligned offsets, all in the byte order of the writing host
+  struct Header {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t order;
+    std::uint64_t count4;
+    std::uint64_t offset4;
+    std::uint64_t count6;
+    std::uint64_t offset6;
+  };
+  const char          magic[8] = {'U', 'P', 'F', 'X', 'T', 'B', 'L', '\0'};
+  const std::uint32_t version  = 1;
+  const std::uint32_t order    = 0x01020304;
+
+  struct Entry {
+    Value         first;
+    Value         last;
+    std::uint8_t  length;
+    std::uint32_t value;
+  };
+
+  /**
+   * @brief Flatten
+   *
+   * Resolves nested prefixes of one family into disjoint ranges carrying the
+   * value of the most specific prefix, merging neighbours of equal value
+   *
+   * @param entries The prefixes of one family
+   * @param max     The highest address of the family
+   * @param emit    Callback invoked with each (first, last, value) range
+   */
+  template <typename F>
+  void flatten(std::vector<Entry>& entries, Value max, F emit) {
+    // Sort by start, wider prefixes first; later duplicates take precedence
+    std::stable_sort(entries.begin(), entries.end(),
+      [](const Entry& a, const Entry& b) {
+        return a.first != b.first ? a.first < b.first : a.length < b.length;
+      });
+    std::vector<Entry> ranges;
+    auto add = [&ranges](Value first, Value last, std::uint32_t value) {
+      if (ranges.size() > 0 && ranges.back().value == value &&
+          ranges.back().last + 1 == first)
+        ranges.back().last = last;
+      else
+        ranges.push_back(Entry{first, last, 0, value});
+    };
+
+    // Walk the prefixes keeping a stack of those enclosing the cursor
+    std::vector<Entry> stack;
+    Value cursor = 0;
+    bool  done   = false;
+    auto close = [&]() {
+      const Entry& top = stack.back();
+      if (!done && cursor <= top.last)
+        add(cursor, top.last, top.value);
+      if (top.last == max)
+        done = true;
+      else if (!done)
+        cursor = std::max(cursor, top.last + 1);
+      stack.pop_back();
+    };
+    for (std::size_t i = 0; i < entries.size(); i++) {
+      const Entry& e = entries[i];
+      if (i + 1 < entries.size() && entries[i + 1].first == e.first &&
+          entries[i + 1].length == e.length)
+        continue;
+      while (stack.size() > 0 && stack.back().last < e.first)
+        close();
+      if (stack.size() > 0 && cursor < e.first)
+        add(cursor, e.first - 1, stack.back().value);
+      cursor = e.first, done = false;
+      stack.push_back(e);
+    }
+    while (stack.size() > 0)
+      close();
+    for (const Entry& r : ranges)
+      emit(r.first, r.last, r.value);
+  }
+}
+
+/**
+ * @brief PrefixTable
+ *
+ * Builds an in-memory longest-prefix-match table from prefixes and values
+ *
+ * @remarks Nested prefixes are resolved up front into sorted, disjoint ranges
+ * so that each lookup is a single binary search. If the same prefix appears
+ * more than once, the last value wins.
+ *
+ * @param entries Pairs of prefixes and their values
+ */
+PrefixTable::PrefixTable(
+    const std::vector<std::pair<Prefix, std::uint32_t>>& entries) {
+  std::vector<Entry> v4, v6;
+  for (const auto& entry : entries) {
+    const Prefix& p = entry.first;
+    if (p.address.length() == 0)
+      continue;
+    (p.address.family == AF_INET ? v4 : v6).push_back(Entry{
+      integer(p.first()), integer(p.last()),
+      p.length, entry.second});
+  }
+
+  flatten(v4, Value{UINT32_MAX}, [this](Value a, Value b, std::uint32_t v) {
+    this->owned4.push_back(Range4{static_cast<std::uint32_t>(a),
+      static_cast<std::uint32_t>(b), v});
+  });
+  flatten(v6, ~Value{0}, [this](Value a, Value b, std::uint32_t v) {
+    Range6 r;
+    unpack(a, r.first);
+    unpack(b, r.last);
+    r.value = v;
+    this->owned6.push_back(r);
+  });
+  this->ranges4 = this->owned4.data(), this->count4 = this->owned4.size();
+  this->ranges6 = this->owned6.data(), this->count6 = this->owned6.size();
+}
+
+PrefixTable::PrefixTable(PrefixTable&& other) noexcept {
+  *this = std::move(other);
+}
+
+PrefixTable& PrefixTable::operator=(PrefixTable&& other) noexcept {
+  if (this != &other) {
+    this->release();
+    this->owned4 = std::move(other.owned4);
+    this->owned6 = std::move(other.owned6);
+    this->ranges4 = other.ranges4, this->count4 = other.count4;
+    this->ranges6 = other.ranges6, this->count6 = other.count6;
+    this->mapping = other.mapping;
+    this->mapping_length = other.mapping_length;
+    other.ranges4 = nullptr, other.count4 = 0;
+    other.ranges6 = nullptr, other.count6 = 0;
+    other.mapping = nullptr, other.mapping_length = 0;
+  }
+  return *this;
+}
+
+PrefixTable::~PrefixTable() {
+  this->release();
+}
+
+/**
+ * @brief Release
+ *
+ * Unmaps the backing file, if any
+ */
+void PrefixTable::release() {
+  if (this->mapping != nullptr)
+    munmap(this->mapping, this->mapping_length);
+  this->mapping = nullptr;
+  this->mapping_length = 0;
+}
+
+/**
+ * @brief Lookup
+ *
+ * Finds the value of the longest prefix containing an address, identically
+ * for built and memory-mapped tables
+ *
+ * @param      a     The Address to look up
+ * @param[out] value Storage for the value found
+ *
+ * @return `true` if a prefix contains the address, otherwise `false`
+ */
+bool PrefixTable::lookup(const Address& a, std::uint32_t& value) const {
+  if (a.family == AF_INET) {
+    std::uint32_t key = static_cast<std::uint32_t>(integer(a));
+    const Range4* end = this->ranges4 + this->count4;
+    const Range4* r = std::upper_bound(this->ranges4, end, key,
+      [](std::uint32_t k, const Range4& x) { return k < x.first; });
+    if (r == this->ranges4 || key > (--r)->last)
+      return false;
+    return value = r->value, true;
+  }
+  if (a.family == AF_INET6) {
+    const Range6* end = this->ranges6 + this->count6;
+    const Range6* r = std::upper_bound(this->ranges6, end, a.bytes,
+      [](const std::uint8_t* k, const Range6& x) {
+        return memcmp(k, x.first, 16) < 0;
+      });
+    if (r == this->ranges6 || memcmp(a.bytes, (--r)->last, 16) > 0)
+      return false;
+    return value = r->value, true;
+  }
+  return false;
+}
+
+/**
+ * @brief Mapped
+ *
+ * @return `true` if the table is backed by a memory-mapped file
+ */
+bool PrefixTable::mapped() const {
+  return this->mapping != nullptr;
+}
+
+/**
+ * @brief Save
+ *
+ * Writes the table in its versioned binary form, replacing the destination
+ * atomically so that running processes can keep their existing mapping
+ *
+ * @param path Path of the file to write
+ *
+ * @throws `std::runtime_error` on failure to write the file
+ */
+void PrefixTable::save(const std::string& path) const {
+  Header header = {};
+  memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.order   = order;
+  header.count4  = this->count4;
+  header.offset4 = (sizeof(Header) + 7) & ~std::uint64_t{7};
+  header.count6  = this->count6;
+  header.offset6 = (header.offset4 + this->count4 * sizeof(Range4) + 7) &
+    ~std::uint64_t{7};
+
+  const std::string temporary = path + ".tmp";
+  int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+    0644);
+  if (fd < 0)
+    throw std::runtime_error{"Could not create the prefix table file."};
+  auto write_at = [fd](const void* data, std::size_t length,
+      std::uint64_t offset) {
+    const char* p = static_cast<const char*>(data);
+    while (length > 0) {
+      ssize_t n = pwrite(fd, p, length, static_cast<off_t>(offset));
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        return false;
+      p += n, length -= static_cast<std::size_t>(n), offset += n;
+    }
+    return true;
+  };
+  bool ok = write_at(&header, sizeof(header), 0) &&
+    write_at(this->ranges4, this->count4 * sizeof(Range4), header.offset4) &&
+    write_at(this->ranges6, this->count6 * sizeof(Range6), header.offset6) &&
+    ftruncate(fd, static_cast<off_t>(header.offset6 +
+      this->count6 * sizeof(Range6))) == 0 && fsync(fd) == 0;
+  ok = close(fd) == 0 && ok;
+  if (!ok || rename(temporary.c_str(), path.c_str()) != 0) {
+    unlink(temporary.c_str());
+    throw std::runtime_error{"Could not write the prefix table file."};
+  }
+}
+
+/**
+ * @brief Size
+ *
+ * @return The number of disjoint ranges in the table
+ */
+std::size_t PrefixTable::size() const {
+  return this->count4 + this->count6;
+}
+
+/**
+ * @brief Map
+ *
+ * Opens a table written by `save` and queries it in place through a shared,
+ * read-only memory mapping, so that startup does no parsing and processes
+ * mapping the same file share its pages
+ *
+ * @param path Path of the file to map
+ *
+ * @throws `std::runtime_error` if the file cannot be mapped or is not a
+ * compatible prefix table
+ *
+ * @return The memory-mapped PrefixTable
+ */
+PrefixTable PrefixTable::map(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    throw std::runtime_error{"Could not open the prefix table file."};
+  struct stat st = {};
+  if (fstat(fd, &st) != 0 ||
+      static_cast<std::size_t>(st.st_size) < sizeof(Header)) {
+    close(fd);
+    throw std::runtime_error{"The prefix table file is invalid."};
+  }
+  const std::size_t length = static_cast<std::size_t>(st.st_size);
+  void* mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED)
+    throw std::runtime_error{"Could not map the prefix table file."};
+
+  PrefixTable table;
+  table.mapping = mapping, table.mapping_length = length;
+  // Validate the header and that both arrays lie within the file
+  const Header& header = *static_cast<const Header*>(mapping);
+  if (memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+      header.version != version || header.order != order ||
+      header.offset4 % 8 != 0 || header.offset6 % 8 != 0 ||
+      header.offset4 > length || header.offset6 > length ||
+      header.count4 > (length - header.offset4) / sizeof(Range4) ||
+      header.count6 > (length - header.offset6) / sizeof(Range6))
+    throw std::runtime_error{"The prefix table file is invalid."};
+  const char* base = static_cast<const char*>(mapping);
+  table.ranges4 = reinterpret_cast<const Range4*>(base + header.offset4);
+  table.count4  = header.count4;
+  table.ranges6 = reinterpret_cast<const Range6*>(base + header.offset6);
+  table.count6  = header.count6;
+  return table;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file  PrefixTable.hpp
+ * @brief PrefixTable
+ *
+ * Class definition for PrefixTable
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _PREFIXTABLE_HPP
+#define _PREFIXTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Address.hpp"
+#include "Prefix.hpp"
+
+class PrefixTable {
+  public:
+    // Disjoint ranges of addresses resolved to the most specific value
+    struct Range4 {
+      std::uint32_t first;
+      std::uint32_t last;
+      std::uint32_t value;
+    };
+    struct Range6 {
+      std::uint8_t  first[16];
+      std::uint8_t  last[16];
+      std::uint32_t value;
+    };
+  private:
+    std::vector<Range4> owned4;
+    std::vector<Range6> owned6;
+    const Range4*       ranges4 = nullptr;
+    std::size_t         count4  = 0;
+    const Range6*       ranges6 = nullptr;
+    std::size_t         count6  = 0;
+    void*               mapping = nullptr;
+    std::size_t         mapping_length = 0;
+    void release();
+  public:
+    PrefixTable() {}
+    PrefixTable(const std::vector<std::pair<Prefix, std::uint32_t>>& entries);
+    PrefixTable(PrefixTable&& other) noexcept;
+    PrefixTable& operator=(PrefixTable&& other) noexcept;
+    PrefixTable(const PrefixTable&) = delete;
+    PrefixTable& operator=(const PrefixTable&) = delete;
+    ~PrefixTable();
+    bool lookup(const Address& a, std::uint32_t& value) const;
+    bool mapped() const;
+    void save(const std::string& path) const;
+    std::size_t size() const;
+
+    static PrefixTable map(const std::string& path);
+};
+
+#endif
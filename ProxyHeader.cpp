@@ -0,0 +1,255 @@
+/**
+ * @file  ProxyHeader.cpp
+ * @brief ProxyHeader
+ *
+ * Class implementation for ProxyHeader
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <netinet/in.h>
+#include <string_view>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "Address.hpp"
+#include "ProxyHeader.hpp"
+
+namespace {
+  constexpr std::string_view signature1{"PROXY ", 6};
+  constexpr std::string_view signature2{"\r\n\r\n\0\r\nQUIT\n", 12};
+  // Longest v1 header, including the trailing CRLF
+  constexpr std::size_t      maximum1 = 107;
+
+  std::uint16_t be16(const char* p) {
+    return static_cast<std::uint16_t>(static_cast<unsigned char>(p[0]) << 8 |
+      static_cast<unsigned char>(p[1]));
+  }
+
+  // Determines whether `data` is a (possibly partial) copy of `signature`
+  bool prefix(std::string_view data, std::string_view signature) {
+    const std::size_t n = std::min(data.length(), signature.length());
+    return data.substr(0, n) == signature.substr(0, n);
+  }
+
+  // Splits the next space-delimited field from `s`
+  std::string_view field(std::string_view& s) {
+    const std::size_t space = s.find(' ');
+    std::string_view result = s.substr(0, space);
+    s.remove_prefix(space == std::string_view::npos ? s.length() : space + 1);
+    return result;
+  }
+
+  // Parses a decimal port without leading zeros
+  bool port(std::string_view s, std::uint16_t& out) {
+    if (s.empty() || s.length() > 5 || (s[0] == '0' && s.length() > 1))
+      return false;
+    std::uint32_t value = 0;
+    for (char c : s) {
+      if (c < '0' || c > '9')
+        return false;
+      value = value * 10 + static_cast<std::uint32_t>(c - '0');
+    }
+    if (value > 65535)
+      return false;
+    out = static_cast<std::uint16_t>(value);
+    return true;
+  }
+}
+
+/**
+ * @brief Find
+ *
+ * Searches the TLV vector for the first entry of the given type
+ *
+ * @param      type  The TLV type (e.g. 0x01 for PP2_TYPE_ALPN)
+ * @param[out] value A view of the entry's value
+ *
+ * @return `true` if an entry was found
+ */
+bool ProxyHeader::find(std::uint8_t type, std::string_view& value) const {
+  std::string_view cursor = this->tlvs;
+  Tlv tlv;
+  while (ProxyHeader::next(cursor, tlv))
+    if (tlv.type == type) {
+      value = tlv.value;
+      return true;
+    }
+  return false;
+}
+
+/**
+ * @brief Next
+ *
+ * Reads one TLV from the front of a cursor over a TLV vector, advancing it
+ *
+ * @param[in,out] cursor The unread TLVs, initially `ProxyHeader::tlvs`
+ * @param[out]    out    Storage for the TLV
+ *
+ * @return `true` if a TLV was read, `false` at the end of the vector
+ */
+bool ProxyHeader::next(std::string_view& cursor, Tlv& out) {
+  if (cursor.length() < 3)
+    return false;
+  const std::size_t length = be16(cursor.data() + 1);
+  if (cursor.length() - 3 < length)
+    return false;
+  out.type  = static_cast<std::uint8_t>(cursor[0]);
+  out.value = cursor.substr(3, length);
+  cursor.remove_prefix(3 + length);
+  return true;
+}
+
+/**
+ * @brief Parse
+ *
+ * Parses a PROXY protocol v1 (text) or v2 (binary) header from the start of a
+ * connection without allocating or copying
+ *
+ * @remarks Views in `out` refer to `data`, which must outlive them. Data
+ * shorter than a complete header that is still consistent with one yields
+ * `Status::Incomplete`, so the caller can read more and try again.
+ *
+ * @param      data     The bytes received so far
+ * @param[out] out      Storage for the parsed header
+ * @param[out] consumed The length of the header on success
+ *
+ * @return The parse Status
+ */
+ProxyHeader::Status ProxyHeader::parse(std::string_view data,
+    ProxyHeader& out, std::size_t& consumed) {
+  out = ProxyHeader{};
+  consumed = 0;
+  if (data.empty())
+    return Status::Incomplete;
+  const Status status = data[0] == signature2[0] ?
+    ProxyHeader::parse2(data, out, consumed) :
+    ProxyHeader::parse1(data, out, consumed);
+  if (status != Status::Ok)
+    out = ProxyHeader{};
+  return status;
+}
+
+/**
+ * @brief Parse Version 1
+ *
+ * Parses "PROXY TCP4|TCP6 <source> <destination> <sport> <dport>\r\n" or
+ * "PROXY UNKNOWN ...\r\n"
+ *
+ * @param      data     The bytes received so far
+ * @param[out] out      Storage for the parsed header
+ * @param[out] consumed The length of the header on success
+ *
+ * @return The parse Status
+ */
+ProxyHeader::Status ProxyHeader::parse1(std::string_view data,
+    ProxyHeader& out, std::size_t& consumed) {
+  if (!prefix(data, signature1))
+    return Status::Invalid;
+  const std::size_t end = data.substr(0, maximum1).find("\r\n");
+  if (end == std::string_view::npos)
+    return data.length() < maximum1 ? Status::Incomplete : Status::Invalid;
+  out.version = 1;
+  std::string_view line = data.substr(signature1.length(),
+    end - signature1.length());
+  const std::string_view family = field(line);
+  if (family == "UNKNOWN") {
+    out.local = true;
+    consumed = end + 2;
+    return Status::Ok;
+  }
+  const int expected = family == "TCP4" ? AF_INET :
+    family == "TCP6" ? AF_INET6 : 0;
+  Address source, destination;
+  if (expected == 0 || !Address::parse(field(line), source) ||
+      !Address::parse(field(line), destination) ||
+      source.family != expected || destination.family != expected ||
+      !port(field(line), source.port) ||
+      !port(field(line), destination.port) || !line.empty())
+    return Status::Invalid;
+  out.protocol         = SOCK_STREAM;
+  out.source           = source.sockaddr();
+  out.destination      = destination.sockaddr();
+  out.source_port      = source.port;
+  out.destination_port = destination.port;
+  consumed = end + 2;
+  return Status::Ok;
+}
+
+/**
+ * @brief Parse Version 2
+ *
+ * Parses the binary header: signature, version and command, family and
+ * protocol, big-endian length, addresses and then TLVs
+ *
+ * @param      data     The bytes received so far
+ * @param[out] out      Storage for the parsed header
+ * @param[out] consumed The length of the header on success
+ *
+ * @return The parse Status
+ */
+ProxyHeader::Status ProxyHeader::parse2(std::string_view data,
+    ProxyHeader& out, std::size_t& consumed) {
+  if (!prefix(data, signature2))
+    return Status::Invalid;
+  if (data.length() < 16)
+    return Status::Incomplete;
+  const unsigned command  = static_cast<unsigned char>(data[12]);
+  const unsigned family   = static_cast<unsigned char>(data[13]);
+  const std::size_t total = 16 + static_cast<std::size_t>(be16(&data[14]));
+  if (command >> 4 != 2 || (command & 0xf) > 1 || family >> 4 > 3 ||
+      (family & 0xf) > 2)
+    return Status::Invalid;
+  if (data.length() < total)
+    return Status::Incomplete;
+  out.version  = 2;
+  out.local    = (command & 0xf) == 0;
+  out.protocol = (family & 0xf) == 1 ? SOCK_STREAM :
+    (family & 0xf) == 2 ? SOCK_DGRAM : 0;
+
+  // Address block sizes for AF_UNSPEC, AF_INET, AF_INET6 and AF_UNIX
+  static const std::size_t sizes[] = {0, 12, 36, 216};
+  const std::size_t size = sizes[family >> 4];
+  if (total - 16 < size)
+    return Status::Invalid;
+  const char* p = data.data() + 16;
+  if (!out.local && (family >> 4 == 1 || family >> 4 == 2)) {
+    const std::size_t length = family >> 4 == 1 ? 4 : 16;
+    Address source, destination;
+    source.family = destination.family = static_cast<std::uint8_t>(
+      length == 4 ? AF_INET : AF_INET6);
+    memcpy(source.bytes, p, length);
+    memcpy(destination.bytes, p + length, length);
+    source.port      = be16(p + length * 2);
+    destination.port = be16(p + length * 2 + 2);
+    out.source           = source.sockaddr();
+    out.destination      = destination.sockaddr();
+    out.source_port      = source.port;
+    out.destination_port = destination.port;
+  } else if (!out.local && family >> 4 == 3) {
+    struct sockaddr_un& source =
+      reinterpret_cast<struct sockaddr_un&>(out.source);
+    struct sockaddr_un& destination =
+      reinterpret_cast<struct sockaddr_un&>(out.destination);
+    source.sun_family = destination.sun_family = AF_UNIX;
+    // Paths are NUL padded to 108 bytes, the size of `sun_path` on Linux
+    memcpy(source.sun_path, p,
+      std::min<std::size_t>(108, sizeof(source.sun_path)));
+    memcpy(destination.sun_path, p + 108,
+      std::min<std::size_t>(108, sizeof(destination.sun_path)));
+  }
+
+  // Every TLV must fit exactly within the header
+  out.tlvs = data.substr(16 + size, total - 16 - size);
+  std::string_view cursor = out.tlvs;
+  Tlv tlv;
+  while (ProxyHeader::next(cursor, tlv)) {}
+  if (!cursor.empty())
+    return Status::Invalid;
+  consumed = total;
+  return Status::Ok;
+}
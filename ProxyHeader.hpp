@@ -0,0 +1,55 @@
+/**
+ * @file  ProxyHeader.hpp
+ * @brief ProxyHeader
+ *
+ * Class definition for ProxyHeader
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _PROXYHEADER_HPP
+#define _PROXYHEADER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <sys/socket.h>
+
+class ProxyHeader {
+  public:
+    enum class Status : std::uint8_t { Ok, Incomplete, Invalid };
+    struct Tlv {
+      std::uint8_t     type = 0;
+      std::string_view value;
+    };
+
+    // Protocol version (1 for text, 2 for binary)
+    std::uint8_t            version          = 0;
+    // Set for v2 LOCAL and v1 UNKNOWN headers, whose addresses are unset
+    bool                    local            = false;
+    // SOCK_STREAM, SOCK_DGRAM or zero when unspecified
+    int                     protocol         = 0;
+    // Same form as `Utility::parse_addr` (AF_UNIX for v2 UNIX headers)
+    struct sockaddr_storage source           = {};
+    struct sockaddr_storage destination      = {};
+    // Host order ports (also present in `source` and `destination`)
+    std::uint16_t           source_port      = 0;
+    std::uint16_t           destination_port = 0;
+    // Raw v2 TLV vector, a view into the parsed buffer
+    std::string_view        tlvs;
+
+    bool find(std::uint8_t type, std::string_view& value) const;
+
+    static bool next(std::string_view& cursor, Tlv& out);
+    static Status parse(std::string_view data, ProxyHeader& out,
+      std::size_t& consumed);
+
+  private:
+    static Status parse1(std::string_view data, ProxyHeader& out,
+      std::size_t& consumed);
+    static Status parse2(std::string_view data, ProxyHeader& out,
+      std::size_t& consumed);
+};
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file  RateLimiter.cpp
+ * @brief RateLimiter
+ *
+ * Class implementation for RateLimiter
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include "Address.hpp"
+#include "Prefix.hpp"
+#include "RateLimiter.hpp"
+#include "Ring.hpp"
+#include "Utility.hpp"
+
+/**
+ * @brief Rate Limiter
+ *
+ * Prepares a token-bucket rate limiter keyed by client address, where each
+ * IPv4 and IPv6 prefix of the configured lengths shares one bucket
+ *
+ * @remarks Memory is fixed at construction: buckets are grouped into small
+ * sets spread across independently locked shards. A client arriving at a
+ * full set takes over the entry holding the most tokens and starts from that
+ * entry's level, which is a full bucket only if the entry had fully refilled,
+ * so cycling through addresses cannot refill a bucket faster than `rate`.
+ * IPv4-mapped IPv6 clients are keyed by `prefix4` bits of the IPv4 address
+ * they embed.
+ *
+ * @param rate     Tokens added per second
+ * @param burst    Bucket size, the most tokens a client can accumulate
+ * @param capacity The number of buckets (rounded up to fill every set)
+ * @param prefix4  Bits of an IPv4 address that identify a client
+ * @param prefix6  Bits of an IPv6 address that identify a client
+ * @param shards   The number of shards (a power of two), or zero to use four
+ *                 per hardware thread
+ *
+ * @throws `std::invalid_argument` if the rate or burst is not positive
+ */
+RateLimiter::RateLimiter(double rate, double burst, std::size_t capacity,
+    std::uint8_t prefix4, std::uint8_t prefix6, std::size_t shards):
+    rate{rate / 1e9}, burst{burst}, prefix4{prefix4}, prefix6{prefix6} {
+  if (!(rate > 0) || !(burst > 0))
+    throw std::invalid_argument{"The rate and burst must be positive."};
+  if (shards == 0)
+    shards = 4 * std::max(1u, std::thread::hardware_concurrency());
+  shards = ring::round(shards);
+  const std::size_t sets = ring::round(std::max<std::size_t>(1,
+    (capacity + shards * RateLimiter::ways - 1) /
+    (shards * RateLimiter::ways)));
+  this->shard_mask = shards - 1;
+  this->set_mask   = sets - 1;
+  this->shards.reset(new Shard[shards]);
+  for (std::size_t i = 0; i < shards; i++)
+    this->shards[i].buckets.reset(new Bucket[sets * RateLimiter::ways]);
+}
+
+/**
+ * @brief Allow
+ *
+ * Takes tokens from a client's bucket using the monotonic clock
+ *
+ * @param a    The client Address
+ * @param cost The number of tokens the request costs
+ *
+ * @return `true` if the request is within the limit
+ */
+bool RateLimiter::allow(const Address& a, double cost) {
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return this->allow(a, static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()), cost);
+}
+
+/**
+ * @brief Allow
+ *
+ * Takes tokens from a client's bucket, first crediting the tokens earned
+ * since its last refill
+ *
+ * @param a    The client Address
+ * @param now  The current time in nanoseconds from any fixed, nonzero epoch
+ * @param cost The number of tokens the request costs
+ *
+ * @return `true` if the request is within the limit
+ */
+bool RateLimiter::allow(const Address& a, std::uint64_t now, double cost) {
+  // IPv4-mapped addresses share the bucket of the IPv4 address they embed
+  static const std::uint8_t mapped[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0xff, 0xff};
+  std::uint8_t bits = this->prefix6;
+  if (a.family == AF_INET)
+    bits = this->prefix4;
+  else if (memcmp(a.bytes, mapped, sizeof(mapped)) == 0)
+    bits = static_cast<std::uint8_t>(96 + std::min<unsigned>(
+      this->prefix4, 32));
+  const Address key = Prefix{a, bits}.address;
+  const std::uint64_t h = Utility::hash(std::string_view{
+    reinterpret_cast<const char*>(key.bytes), sizeof(key.bytes)}) ^
+    key.family;
+  Shard& shard = this->shards[(h >> 48) & this->shard_mask];
+  std::lock_guard<std::mutex> guard{shard.lock};
+
+  // The tokens a bucket holds once refilled up to `now`
+  auto level = [&](const Bucket& b) {
+    if (b.stamp == 0)
+      return this->burst;
+    if (now <= b.stamp)
+      return b.tokens;
+    return std::min(this->burst, b.tokens +
+      static_cast<double>(now - b.stamp) * this->rate);
+  };
+  Bucket* set = &shard.buckets[(h & this->set_mask) * RateLimiter::ways];
+  Bucket* bucket = nullptr;
+  Bucket* fullest = set;
+  double most = level(*set);
+  for (std::size_t i = 0; i < RateLimiter::ways; i++) {
+    if (set[i].stamp != 0 && set[i].family == key.family &&
+        memcmp(set[i].bytes, key.bytes, sizeof(key.bytes)) == 0) {
+      bucket = &set[i];
+      break;
+    }
+    const double tokens = level(set[i]);
+    if (tokens > most)
+      fullest = &set[i], most = tokens;
+  }
+  if (bucket == nullptr) {
+    // Take over the entry with the most tokens, inheriting its level
+    bucket = fullest;
+    memcpy(bucket->bytes, key.bytes, sizeof(key.bytes));
+    bucket->family = key.family;
+    bucket->tokens = most;
+  } else {
+    bucket->tokens = level(*bucket);
+  }
+  bucket->stamp = std::max<std::uint64_t>(now, bucket->stamp);
+  if (bucket->tokens < cost)
+    return false;
+  bucket->tokens -= cost;
+  return true;
+}
+
+/**
+ * @brief Capacity
+ *
+ * @return The total number of buckets across all shards
+ */
+std::size_t RateLimiter::capacity() const {
+  return (this->shard_mask + 1) * (this->set_mask + 1) * RateLimiter::ways;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file  RateLimiter.hpp
+ * @brief RateLimiter
+ *
+ * Class definition for RateLimiter
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _RATELIMITER_HPP
+#define _RATELIMITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "Address.hpp"
+#include "Ring.hpp"
+
+class RateLimiter {
+  private:
+    // Number of buckets sharing one set; a full set reuses its fullest entry
+    static constexpr std::size_t ways = 8;
+
+    struct Bucket {
+      std::uint8_t  bytes[16] = {};
+      std::uint8_t  family    = 0;
+      double        tokens    = 0;
+      // Time of the last refill in nanoseconds, zero when the bucket is free
+      std::uint64_t stamp     = 0;
+    };
+    struct alignas(ring::cache_line) Shard {
+      std::mutex                lock;
+      std::unique_ptr<Bucket[]> buckets;
+    };
+
+    double                   rate;
+    double                   burst;
+    std::uint8_t             prefix4;
+    std::uint8_t             prefix6;
+    std::size_t              shard_mask;
+    std::size_t              set_mask;
+    std::unique_ptr<Shard[]> shards;
+
+  public:
+    RateLimiter(double rate, double burst, std::size_t capacity = 1 << 16,
+      std::uint8_t prefix4 = 32, std::uint8_t prefix6 = 64,
+      std::size_t shards = 0);
+    bool allow(const Address& a, double cost = 1);
+    bool allow(const Address& a, std::uint64_t now, double cost = 1);
+    std::size_t capacity() const;
+};
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file  Replacer.cpp
+ * @brief Replacer
+ *
+ * Class implementation for Replacer
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "Replacer.hpp"
+
+/**
+ * @brief Replacer
+ *
+ * Constructs a streaming equivalent of `Utility::replace` that accepts its
+ * subject as a sequence of chunks and produces its result as a sequence of
+ * output chunks
+ *
+ * @param search  The substring that will be replaced
+ * @param replace The new value replacing `search`
+ * @param limit   Maximum number of replacements, or zero for no limit
+ */
+Replacer::Replacer(const std::string& search, const std::string& replace,
+    const int limit): search{search}, replace{replace}, limit{limit} {}
+
+/**
+ * @brief Exhausted
+ *
+ * Determines whether no further replacements may be performed
+ *
+ * @return `true` if the search string is empty or the limit was reached
+ */
+bool Replacer::exhausted() const {
+  return this->search.length() == 0 ||
+    (this->limit != 0 && this->count >= this->limit);
+}
+
+/**
+ * @brief Feed
+ *
+ * Performs replacements on the next chunk of the subject, invoking the
+ * callback with each piece of output that can no longer be affected by later
+ * input
+ *
+ * @remarks Up to `search.length() - 1` trailing bytes are held back in case
+ * they begin an occurrence completed by the next chunk. Output views are only
+ * valid for the duration of the callback.
+ *
+ * @param chunk The next chunk of the subject
+ * @param cb    Callback invoked with each piece of output
+ */
+void Replacer::feed(std::string_view chunk, const Callback& cb) {
+  const std::string_view s{this->search};
+  std::size_t lpos = 0;
+
+  if (this->exhausted()) {
+    // Pass everything through once no more replacements can happen
+    if (this->pending.length() > 0)
+      cb(this->pending), this->pending.clear();
+    if (chunk.length() > 0)
+      cb(chunk);
+    return;
+  }
+
+  if (this->pending.length() > 0) {
+    // Look for an occurrence beginning in the held back bytes
+    std::size_t held = this->pending.length();
+    std::string edge{this->pending};
+    edge.append(chunk.substr(0, s.length() - 1));
+    std::size_t epos = edge.find(s);
+    if (epos != std::string::npos && epos < held) {
+      if (epos > 0)
+        cb(std::string_view{edge}.substr(0, epos));
+      cb(this->replace);
+      this->count++;
+      this->pending.clear();
+      lpos = epos + s.length() - held;
+    } else if (chunk.length() >= s.length() - 1) {
+      // No occurrence can begin in the held back bytes any more
+      cb(this->pending);
+      this->pending.clear();
+    } else {
+      // The chunk was too short to decide; hold back the combined tail
+      std::size_t keep = std::min(edge.length(), s.length() - 1);
+      if (edge.length() > keep)
+        cb(std::string_view{edge}.substr(0, edge.length() - keep));
+      this->pending.assign(edge, edge.length() - keep, keep);
+      return;
+    }
+  }
+
+  for (std::size_t cpos = 0; !this->exhausted() &&
+      (cpos = chunk.find(s, lpos)) != std::string_view::npos;
+      lpos = cpos + s.length()) {
+    // Emit the unchanged text preceding the occurrence, then the replacement
+    if (cpos > lpos)
+      cb(chunk.substr(lpos, cpos - lpos));
+    cb(this->replace);
+    this->count++;
+  }
+
+  // Hold back a possible partial occurrence at the end of the chunk
+  std::size_t keep = this->exhausted() ? 0 :
+    std::min(chunk.length() - lpos, s.length() - 1);
+  if (chunk.length() - keep > lpos)
+    cb(chunk.substr(lpos, chunk.length() - keep - lpos));
+  this->pending.assign(chunk.substr(chunk.length() - keep));
+}
+
+/**
+ * @brief Finish
+ *
+ * Signals the end of the subject, emitting any held back output and
+ * resetting the replacement count
+ *
+ * @param cb Callback invoked with the remaining output
+ */
+void Replacer::finish(const Callback& cb) {
+  if (this->pending.length() > 0)
+    cb(this->pending);
+  this->pending.clear();
+  this->count = 0;
+}
+
+/**
+ * @brief Replacement
+ *
+ * Views the replacement string, into which the views passed to callbacks
+ * for each replacement point
+ *
+ * @return std::string_view valid for the lifetime of the Replacer
+ */
+std::string_view Replacer::replacement() const {
+  return this->replace;
+}
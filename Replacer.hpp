@@ -0,0 +1,37 @@
+/**
+ * @file  Replacer.hpp
+ * @brief Replacer
+ *
+ * Class definition for Replacer
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _REPLACER_HPP
+#define _REPLACER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+class Replacer {
+  public:
+    typedef std::function<void(std::string_view)> Callback;
+  private:
+    std::string search;
+    std::string replace;
+    std::string pending;
+    int         limit;
+    int         count = 0;
+    bool exhausted() const;
+  public:
+    Replacer(const std::string& search, const std::string& replace,
+      const int limit = 0);
+    void feed(std::string_view chunk, const Callback& cb);
+    void finish(const Callback& cb);
+    std::string_view replacement() const;
+};
+
+#endif
@@ -0,0 +1,291 @@
+/**
+ * @file  Ring.hpp
+ * @brief Ring
+ *
+ * Class definitions for lock-free ring buffers
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _RING_HPP
+#define _RING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ring {
+  // Assumed size of a cache line, used to keep indices on separate lines
+  constexpr std::size_t cache_line = 64;
+
+  inline std::size_t round(std::size_t n) {
+    std::size_t result = 1;
+    while (result < n)
+      result <<= 1;
+    return result;
+  }
+}
+
+/**
+ * @brief Single-Producer Single-Consumer Ring
+ *
+ * Bounded lock-free queue for passing items (e.g. the views or batches of
+ * views produced by `Utility::explode` and `Splitter`) between exactly two
+ * threads
+ *
+ * @remarks The capacity is rounded up to a power of two. Each side keeps its
+ * own index and a cached copy of the other side's index on its own cache line
+ * so that the shared indices are only read when the cached copy runs out.
+ */
+template <typename T>
+class SpscRing {
+  private:
+    std::vector<T>                                    items;
+    std::size_t                                       mask;
+    // Consumer owned
+    alignas(ring::cache_line) std::atomic<std::size_t> head{0};
+    std::size_t                                       tail_cache = 0;
+    // Producer owned
+    alignas(ring::cache_line) std::atomic<std::size_t> tail{0};
+    std::size_t                                       head_cache = 0;
+    char pad[ring::cache_line - sizeof(std::size_t) * 2];
+
+    std::size_t writable(std::size_t t) {
+      if (t - this->head_cache == this->items.size())
+        this->head_cache = this->head.load(std::memory_order_acquire);
+      return this->items.size() - (t - this->head_cache);
+    }
+    std::size_t readable(std::size_t h) {
+      if (h == this->tail_cache)
+        this->tail_cache = this->tail.load(std::memory_order_acquire);
+      return this->tail_cache - h;
+    }
+  public:
+    SpscRing(std::size_t capacity): items(ring::round(capacity)),
+      mask{items.size() - 1} {}
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Try Push
+     *
+     * Appends an item to the ring if there is space (producer only)
+     *
+     * @param item The item to append
+     *
+     * @return `true` if the item was appended, `false` if the ring was full
+     */
+    bool try_push(T&& item) {
+      const std::size_t t = this->tail.load(std::memory_order_relaxed);
+      if (this->writable(t) == 0)
+        return false;
+      this->items[t & this->mask] = std::move(item);
+      this->tail.store(t + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool try_push(const T& item) {
+      return this->try_push(T{item});
+    }
+
+    /**
+     * @brief Try Push (Batch)
+     *
+     * Moves as many of the given items into the ring as there is space for,
+     * publishing them to the consumer at once (producer only)
+     *
+     * @param items Pointer to the items to append
+     * @param n     Number of items to append
+     *
+     * @return The number of items appended, from the front of `items`
+     */
+    std::size_t try_push(T* items, std::size_t n) {
+      const std::size_t t = this->tail.load(std::memory_order_relaxed);
+      std::size_t k = std::min(n, this->writable(t));
+      for (std::size_t i = 0; i < k; i++)
+        this->items[(t + i) & this->mask] = std::move(items[i]);
+      this->tail.store(t + k, std::memory_order_release);
+      return k;
+    }
+
+    /**
+     * @brief Try Pop
+     *
+     * Removes the oldest item from the ring if there is one (consumer only)
+     *
+     * @param[out] item Storage for the removed item
+     *
+     * @return `true` if an item was removed, `false` if the ring was empty
+     */
+    bool try_pop(T& item) {
+      const std::size_t h = this->head.load(std::memory_order_relaxed);
+      if (this->readable(h) == 0)
+        return false;
+      item = std::move(this->items[h & this->mask]);
+      this->head.store(h + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief Try Pop (Batch)
+     *
+     * Removes up to `n` of the oldest items from the ring at once (consumer
+     * only)
+     *
+     * @param[out] items Storage for the removed items
+     * @param      n     Maximum number of items to remove
+     *
+     * @return The number of items removed
+     */
+    std::size_t try_pop(T* items, std::size_t n) {
+      const std::size_t h = this->head.load(std::memory_order_relaxed);
+      std::size_t k = std::min(n, this->readable(h));
+      for (std::size_t i = 0; i < k; i++)
+        items[i] = std::move(this->items[(h + i) & this->mask]);
+      this->head.store(h + k, std::memory_order_release);
+      return k;
+    }
+
+    std::size_t capacity() const {
+      return this->items.size();
+    }
+};
+
+/**
+ * @brief Multi-Producer Multi-Consumer Ring
+ *
+ * Bounded lock-free queue for fanning items out to (or in from) several
+ * pipeline stages
+ *
+ * @remarks Each cell carries a sequence number recording whether it is ready
+ * to be written or read for a given lap of the ring, so producers and
+ * consumers only contend on their own shared index. The capacity is rounded
+ * up to a power of two.
+ */
+template <typename T>
+class MpmcRing {
+  private:
+    struct alignas(ring::cache_line) Cell {
+      std::atomic<std::size_t> sequence;
+      T                        item;
+    };
+    std::unique_ptr<Cell[]>                            cells;
+    std::size_t                                        mask;
+    alignas(ring::cache_line) std::atomic<std::size_t> head{0};
+    alignas(ring::cache_line) std::atomic<std::size_t> tail{0};
+    char pad[ring::cache_line - sizeof(std::size_t)];
+
+    /**
+     * @brief Claim
+     *
+     * Reserves up to `n` consecutive cells starting at the shared index whose
+     * sequence numbers are `position + offset`
+     *
+     * @param      index  The shared index to advance
+     * @param      offset Sequence offset marking a cell as ready for this side
+     * @param      n      Maximum number of cells to claim
+     * @param[out] start  The first claimed position
+     *
+     * @return The number of cells claimed
+     */
+    std::size_t claim(std::atomic<std::size_t>& index, std::size_t offset,
+        std::size_t n, std::size_t& start) {
+      std::size_t position = index.load(std::memory_order_relaxed);
+      for (;;) {
+        // Count the consecutive cells that are ready for this lap
+        std::size_t k = 0;
+        for (; k < n; k++) {
+          const Cell& cell = this->cells[(position + k) & this->mask];
+          if (cell.sequence.load(std::memory_order_acquire) !=
+              position + k + offset)
+            break;
+        }
+        if (k == 0) {
+          // Retry if another thread has advanced the index meanwhile
+          std::size_t current = index.load(std::memory_order_relaxed);
+          if (current == position)
+            return 0;
+          position = current;
+          continue;
+        }
+        if (index.compare_exchange_weak(position, position + k,
+            std::memory_order_relaxed))
+          return start = position, k;
+      }
+    }
+  public:
+    MpmcRing(std::size_t capacity):
+        cells{new Cell[ring::round(capacity < 2 ? 2 : capacity)]},
+        mask{ring::round(capacity < 2 ? 2 : capacity) - 1} {
+      for (std::size_t i = 0; i <= this->mask; i++)
+        this->cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    /**
+     * @brief Try Push (Batch)
+     *
+     * Moves as many of the given items into the ring as there are
+     * consecutive free cells for
+     *
+     * @param items Pointer to the items to append
+     * @param n     Number of items to append
+     *
+     * @return The number of items appended, from the front of `items`
+     */
+    std::size_t try_push(T* items, std::size_t n) {
+      std::size_t start = 0, k = this->claim(this->tail, 0, n, start);
+      for (std::size_t i = 0; i < k; i++) {
+        Cell& cell = this->cells[(start + i) & this->mask];
+        cell.item = std::move(items[i]);
+        cell.sequence.store(start + i + 1, std::memory_order_release);
+      }
+      return k;
+    }
+
+    bool try_push(T&& item) {
+      return this->try_push(&item, 1) == 1;
+    }
+
+    bool try_push(const T& item) {
+      T copy{item};
+      return this->try_push(&copy, 1) == 1;
+    }
+
+    /**
+     * @brief Try Pop (Batch)
+     *
+     * Removes up to `n` of the oldest consecutive published items at once
+     *
+     * @param[out] items Storage for the removed items
+     * @param      n     Maximum number of items to remove
+     *
+     * @return The number of items removed
+     */
+    std::size_t try_pop(T* items, std::size_t n) {
+      std::size_t start = 0, k = this->claim(this->head, 1, n, start);
+      for (std::size_t i = 0; i < k; i++) {
+        Cell& cell = this->cells[(start + i) & this->mask];
+        items[i] = std::move(cell.item);
+        // Mark the cell as free for the producers' next lap
+        cell.sequence.store(start + i + this->mask + 1,
+          std::memory_order_release);
+      }
+      return k;
+    }
+
+    bool try_pop(T& item) {
+      return this->try_pop(&item, 1) == 1;
+    }
+
+    std::size_t capacity() const {
+      return this->mask + 1;
+    }
+};
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * @file  Splitter.cpp
+ * @brief Splitter
+ *
+ * Class implementation for Splitter
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "Splitter.hpp"
+
+/**
+ * @brief Splitter
+ *
+ * Constructs a streaming equivalent of `Utility::explode` that accepts its
+ * input as a sequence of chunks rather than one contiguous std::string
+ *
+ * @param d The delimiter used to separate fields
+ *
+ * @throws `std::invalid_argument` when the delimiter is empty
+ */
+Splitter::Splitter(const std::string& d): delimiter{d} {
+  if (this->delimiter.length() == 0)
+    throw std::invalid_argument{"The delimiter must not be empty."};
+}
+
+/**
+ * @brief Feed
+ *
+ * Scans the next chunk of input for delimiters, invoking the callback once for
+ * each field that is completed within this chunk
+ *
+ * @remarks Fields that are wholly contained in the chunk are passed as views
+ * into `data`; fields that straddle chunk boundaries are assembled internally.
+ * In either case the view is only valid for the duration of the callback.
+ *
+ * @param data   Pointer to the chunk of input
+ * @param length Length of the chunk of input
+ * @param cb     Callback invoked with each completed field
+ */
+void Splitter::feed(const char* data, std::size_t length, const Callback& cb) {
+  this->feed(std::string_view{data, length}, cb);
+}
+
+/**
+ * @brief Feed
+ *
+ * Scans the next chunk of input for delimiters, invoking the callback once for
+ * each field that is completed within this chunk
+ *
+ * @param chunk The chunk of input
+ * @param cb    Callback invoked with each completed field
+ */
+void Splitter::feed(std::string_view chunk, const Callback& cb) {
+  const std::string_view d{this->delimiter};
+  std::size_t lpos = 0;
+
+  if (this->pending.length() > 0) {
+    // Check for a delimiter that begins in the carried field and ends in chunk
+    std::size_t tail = std::min(this->pending.length(), d.length() - 1);
+    std::string edge{this->pending, this->pending.length() - tail};
+    edge.append(chunk.substr(0, d.length() - 1));
+    std::size_t epos = edge.find(d);
+    if (epos != std::string::npos && epos < tail) {
+      // Emit the carried field up to the start of the delimiter
+      this->pending.resize(this->pending.length() - tail + epos);
+      cb(this->pending);
+      this->pending.clear();
+      lpos = epos + d.length() - tail;
+    } else {
+      std::size_t cpos = chunk.find(d);
+      // Without a delimiter the whole chunk belongs to the carried field
+      if (cpos == std::string_view::npos) {
+        this->pending.append(chunk);
+        return;
+      }
+      // Complete the carried field with the start of this chunk
+      this->pending.append(chunk.substr(0, cpos));
+      cb(this->pending);
+      this->pending.clear();
+      lpos = cpos + d.length();
+    }
+  }
+
+  for (std::size_t cpos = 0; (cpos = chunk.find(d, lpos)) !=
+      std::string_view::npos; lpos = cpos + d.length())
+    // Emit each field wholly contained in this chunk without copying
+    cb(chunk.substr(lpos, cpos - lpos));
+  // Carry the unterminated remainder into the next chunk
+  this->pending.append(chunk.substr(lpos));
+}
+
+/**
+ * @brief Finish
+ *
+ * Signals the end of input, emitting the final field that has no trailing
+ * delimiter (which may be empty, as with `Utility::explode`)
+ *
+ * @param cb Callback invoked with the final field
+ */
+void Splitter::finish(const Callback& cb) {
+  cb(this->pending);
+  this->pending.clear();
+}
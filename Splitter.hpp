@@ -0,0 +1,32 @@
+/**
+ * @file  Splitter.hpp
+ * @brief Splitter
+ *
+ * Class definition for Splitter
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _SPLITTER_HPP
+#define _SPLITTER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+class Splitter {
+  public:
+    typedef std::function<void(std::string_view)> Callback;
+  private:
+    std::string delimiter;
+    std::string pending;
+  public:
+    Splitter(const std::string& d);
+    void feed(const char* data, std::size_t length, const Callback& cb);
+    void feed(std::string_view chunk, const Callback& cb);
+    void finish(const Callback& cb);
+};
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file  SubstringIndex.cpp
+ * @brief SubstringIndex
+ *
+ * Class implementation for SubstringIndex
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "SubstringIndex.hpp"
+
+/**
+ * @brief SubstringIndex
+ *
+ * Builds a suffix array over the subject by prefix doubling with radix sorted
+ * rank pairs, in O(n log n) time, so that occurrences of arbitrary needles can
+ * afterwards be found by binary search
+ *
+ * @param subject The std::string to index
+ *
+ * @throws `std::length_error` when the subject is 4 GiB or larger
+ */
+SubstringIndex::SubstringIndex(std::string subject): subject{
+    std::move(subject)} {
+  const std::size_t n = this->subject.length();
+  if (n >= UINT32_MAX)
+    throw std::length_error{"The subject is too large to index."};
+  std::vector<std::uint32_t>& sa = this->suffixes;
+  std::vector<std::uint32_t> rank(n), tmp(n), count;
+  sa.resize(n);
+
+  // Initial ranks are the bytes themselves
+  for (std::size_t i = 0; i < n; i++)
+    rank[i] = static_cast<unsigned char>(this->subject[i]);
+  std::size_t classes = 256;
+  for (std::size_t i = 0; i < n; i++)
+    sa[i] = static_cast<std::uint32_t>(i);
+  std::stable_sort(sa.begin(), sa.end(), [&rank](std::uint32_t a,
+      std::uint32_t b) { return rank[a] < rank[b]; });
+
+  for (std::size_t k = 1; n > 1; k <<= 1) {
+    // Order by the second half: suffixes without one come first
+    std::size_t p = 0;
+    for (std::size_t i = n - std::min(k, n); i < n; i++)
+      tmp[p++] = static_cast<std::uint32_t>(i);
+    for (std::size_t i = 0; i < n; i++)
+      if (sa[i] >= k)
+        tmp[p++] = static_cast<std::uint32_t>(sa[i] - k);
+
+    // Stable counting sort by the first half
+    count.assign(classes + 1, 0);
+    for (std::size_t i = 0; i < n; i++)
+      count[rank[i] + 1]++;
+    for (std::size_t c = 1; c <= classes; c++)
+      count[c] += count[c - 1];
+    for (std::size_t i = 0; i < n; i++)
+      sa[count[rank[tmp[i]]]++] = tmp[i];
+
+    // Assign new ranks to equal rank pairs
+    auto second = [&](std::uint32_t i) -> std::int64_t {
+      return i + k < n ? rank[i + k] : -1;
+    };
+    tmp[sa[0]] = 0;
+    for (std::size_t i = 1; i < n; i++)
+      tmp[sa[i]] = tmp[sa[i - 1]] + (rank[sa[i]] != rank[sa[i - 1]] ||
+        second(sa[i]) != second(sa[i - 1]));
+    rank.swap(tmp);
+    if ((classes = rank[sa[n - 1]] + 1) == n)
+      break;
+  }
+}
+
+/**
+ * @brief Range
+ *
+ * Binary searches the suffix array for the suffixes beginning with a needle
+ *
+ * @param needle The substring to search for
+ *
+ * @return Half-open range of suffix array positions
+ */
+std::pair<std::size_t, std::size_t> SubstringIndex::range(
+    std::string_view needle) const {
+  const std::string_view s{this->subject};
+  auto prefix = [&](std::uint32_t i) {
+    return s.substr(i, needle.length());
+  };
+  auto lo = std::lower_bound(this->suffixes.begin(), this->suffixes.end(),
+    needle, [&](std::uint32_t i, std::string_view v) {
+      return prefix(i) < v;
+    });
+  auto hi = std::upper_bound(lo, this->suffixes.end(), needle,
+    [&](std::string_view v, std::uint32_t i) {
+      return v < prefix(i);
+    });
+  return {static_cast<std::size_t>(lo - this->suffixes.begin()),
+    static_cast<std::size_t>(hi - this->suffixes.begin())};
+}
+
+/**
+ * @brief Count
+ *
+ * Counts the (possibly overlapping) occurrences of a needle in O(m log n)
+ *
+ * @param needle The substring to count
+ *
+ * @return Number of occurrences, or zero for an empty needle
+ */
+std::size_t SubstringIndex::count(std::string_view needle) const {
+  if (needle.length() == 0)
+    return 0;
+  auto r = this->range(needle);
+  return r.second - r.first;
+}
+
+/**
+ * @brief Find
+ *
+ * Finds every (possibly overlapping) occurrence of a needle without scanning
+ * the subject
+ *
+ * @param needle The substring to search for
+ *
+ * @return Sorted std::vector of offsets, empty for an empty needle
+ */
+std::vector<std::size_t> SubstringIndex::find(std::string_view needle) const {
+  std::vector<std::size_t> result;
+  if (needle.length() == 0)
+    return result;
+  auto r = this->range(needle);
+  result.assign(this->suffixes.begin() + r.first,
+    this->suffixes.begin() + r.second);
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/**
+ * @brief Replace
+ *
+ * Applies several `Utility::replace` style substitutions to the subject in a
+ * single output pass, locating every occurrence through the index
+ *
+ * @remarks Each search string is replaced at its leftmost non-overlapping
+ * occurrences in the original subject. Where occurrences of different search
+ * strings overlap, the one listed first in `edits` wins. Replacement text is
+ * never searched again.
+ *
+ * @param edits Pairs of search strings and their replacements
+ *
+ * @return The resulting std::string
+ */
+std::string SubstringIndex::replace(
+    const std::vector<std::pair<std::string, std::string>>& edits) const {
+  // Accepted edits keyed by offset, mapping to (length, replacement)
+  std::map<std::size_t, std::pair<std::size_t, const std::string*>> accepted;
+  for (const auto& edit : edits) {
+    std::size_t end = 0, length = edit.first.length();
+    for (std::size_t offset : this->find(edit.first)) {
+      if (offset < end)
+        continue;
+      end = offset + length;
+      // Skip occurrences overlapping an edit from an earlier pair
+      auto next = accepted.lower_bound(offset);
+      if (next != accepted.end() && next->first < offset + length)
+        continue;
+      if (next != accepted.begin() &&
+          std::prev(next)->first + std::prev(next)->second.first > offset)
+        continue;
+      accepted.emplace(offset, std::make_pair(length, &edit.second));
+    }
+  }
+
+  // Size the result, then copy unchanged spans and replacements in order
+  std::size_t total = this->subject.length();
+  for (const auto& edit : accepted)
+    total = total - edit.second.first + edit.second.second->length();
+  std::string result;
+  result.reserve(total);
+  std::size_t lpos = 0;
+  for (const auto& edit : accepted) {
+    result.append(this->subject, lpos, edit.first - lpos);
+    result.append(*edit.second.second);
+    lpos = edit.first + edit.second.first;
+  }
+  result.append(this->subject, lpos, std::string::npos);
+  return result;
+}
+
+/**
+ * @brief String
+ *
+ * Accesses the indexed subject
+ *
+ * @return The indexed std::string
+ */
+const std::string& SubstringIndex::str() const {
+  return this->subject;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file  SubstringIndex.hpp
+ * @brief SubstringIndex
+ *
+ * Class definition for SubstringIndex
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _SUBSTRINGINDEX_HPP
+#define _SUBSTRINGINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class SubstringIndex {
+  private:
+    std::string                subject;
+    std::vector<std::uint32_t> suffixes;
+    std::pair<std::size_t, std::size_t> range(std::string_view needle) const;
+  public:
+    SubstringIndex(std::string subject);
+    std::size_t count(std::string_view needle) const;
+    std::vector<std::size_t> find(std::string_view needle) const;
+    std::string replace(
+      const std::vector<std::pair<std::string, std::string>>& edits) const;
+    const std::string& str() const;
+};
+
+#endif
@@ -0,0 +1,389 @@
+/**
+ * @file  TokenCounter.cpp
+ * @brief TokenCounter
+ *
+ * Class implementation for TokenCounter
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "TokenCounter.hpp"
+#include "Utility.hpp"
+
+namespace {
+  /**
+   * @brief Table
+   *
+   * Open addressing hash table from a token (a view into the input plus its
+   * precomputed hash) to a 64-bit value, using linear probing with
+   * backward-shift deletion
+   */
+  class Table {
+    private:
+      struct Slot {
+        const char*   data   = nullptr;
+        std::size_t   length = 0;
+        std::uint64_t hash   = 0;
+        std::uint64_t value  = 0;
+        bool          used   = false;
+      };
+      std::vector<Slot> slots;
+      std::size_t       mask;
+      std::size_t       used = 0;
+
+      std::size_t probe(std::string_view key, std::uint64_t hash) const {
+        std::size_t i = hash & this->mask;
+        while (this->slots[i].used && (this->slots[i].hash != hash ||
+            std::string_view{this->slots[i].data, this->slots[i].length} !=
+            key))
+          i = (i + 1) & this->mask;
+        return i;
+      }
+      void grow() {
+        std::vector<Slot> old(this->slots.size() * 2);
+        old.swap(this->slots);
+        this->mask = this->slots.size() - 1;
+        for (const Slot& slot : old)
+          if (slot.used)
+            this->slots[this->probe({slot.data, slot.length}, slot.hash)] =
+              slot;
+      }
+    public:
+      Table(std::size_t capacity = 1024) {
+        std::size_t size = 16;
+        while (size < capacity * 2)
+          size <<= 1;
+        this->slots.resize(size);
+        this->mask = size - 1;
+      }
+
+      std::uint64_t& insert(std::string_view key, std::uint64_t hash) {
+        std::size_t i = this->probe(key, hash);
+        if (!this->slots[i].used) {
+          // Keep the load factor at or below one half
+          if ((this->used + 1) * 2 > this->slots.size())
+            this->grow(), i = this->probe(key, hash);
+          this->slots[i] = Slot{key.data(), key.length(), hash, 0, true};
+          this->used++;
+        }
+        return this->slots[i].value;
+      }
+
+      std::uint64_t* find(std::string_view key, std::uint64_t hash) {
+        std::size_t i = this->probe(key, hash);
+        return this->slots[i].used ? &this->slots[i].value : nullptr;
+      }
+
+      void erase(std::string_view key, std::uint64_t hash) {
+        std::size_t i = this->probe(key, hash);
+        if (!this->slots[i].used)
+          return;
+        // Shift following entries back into the hole where that is allowed
+        for (std::size_t j = (i + 1) & this->mask; this->slots[j].used;
+            j = (j + 1) & this->mask) {
+          std::size_t home = this->slots[j].hash & this->mask;
+          if (((j - home) & this->mask) >= ((j - i) & this->mask))
+            this->slots[i] = this->slots[j], i = j;
+        }
+        this->slots[i] = Slot{};
+        this->used--;
+      }
+
+      template <typename F>
+      void each(F f) const {
+        for (const Slot& slot : this->slots)
+          if (slot.used)
+            f(std::string_view{slot.data, slot.length}, slot.hash, slot.value);
+      }
+
+      std::size_t size() const {
+        return this->used;
+      }
+  };
+
+  /**
+   * @brief Summary
+   *
+   * Space-Saving heavy hitters summary: a fixed number of counters kept in a
+   * min-heap, where an unseen token replaces the smallest counter and
+   * inherits its count as an overestimate
+   */
+  class Summary {
+    private:
+      struct Counter {
+        std::string_view token;
+        std::uint64_t    hash;
+        std::uint64_t    count;
+      };
+      std::vector<Counter> heap;
+      Table                index;
+      std::size_t          capacity;
+
+      void swap(std::size_t a, std::size_t b) {
+        std::swap(this->heap[a], this->heap[b]);
+        *this->index.find(this->heap[a].token, this->heap[a].hash) = a;
+        *this->index.find(this->heap[b].token, this->heap[b].hash) = b;
+      }
+      void sift_up(std::size_t i) {
+        for (; i > 0 && this->heap[(i - 1) / 2].count > this->heap[i].count;
+            i = (i - 1) / 2)
+          this->swap(i, (i - 1) / 2);
+      }
+      void sift_down(std::size_t i) {
+        for (;;) {
+          std::size_t min = i, l = i * 2 + 1, r = l + 1;
+          if (l < this->heap.size() &&
+              this->heap[l].count < this->heap[min].count)
+            min = l;
+          if (r < this->heap.size() &&
+              this->heap[r].count < this->heap[min].count)
+            min = r;
+          if (min == i)
+            return;
+          this->swap(i, min);
+          i = min;
+        }
+      }
+    public:
+      Summary(std::size_t capacity): index{capacity}, capacity{capacity} {
+        this->heap.reserve(capacity);
+      }
+
+      void add(std::string_view token, std::uint64_t hash,
+          std::uint64_t n = 1) {
+        if (std::uint64_t* position = this->index.find(token, hash)) {
+          this->heap[*position].count += n;
+          this->sift_down(*position);
+        } else if (this->heap.size() < this->capacity) {
+          this->heap.push_back(Counter{token, hash, n});
+          this->index.insert(token, hash) = this->heap.size() - 1;
+          this->sift_up(this->heap.size() - 1);
+        } else {
+          // Evict the smallest counter, inheriting its count
+          Counter& min = this->heap[0];
+          this->index.erase(min.token, min.hash);
+          min = Counter{token, hash, min.count + n};
+          this->index.insert(token, hash) = 0;
+          this->sift_down(0);
+        }
+      }
+
+      // Upper bound on the count of any token this summary does not track
+      std::uint64_t minimum() const {
+        return this->heap.size() < this->capacity ? 0 : this->heap[0].count;
+      }
+
+      template <typename F>
+      void each(F f) const {
+        for (const Counter& counter : this->heap)
+          f(counter.token, counter.hash, counter.count);
+      }
+  };
+
+  /**
+   * @brief Tokenize
+   *
+   * Invokes a callback with every non-empty field of every line in a chunk
+   */
+  template <typename F>
+  void tokenize(std::string_view chunk, std::string_view line,
+      std::string_view field, F f) {
+    for (std::size_t lpos = 0; lpos <= chunk.length();) {
+      std::size_t lend = chunk.find(line, lpos);
+      if (lend == std::string_view::npos)
+        lend = chunk.length();
+      std::string_view record = chunk.substr(lpos, lend - lpos);
+      for (std::size_t fpos = 0; fpos <= record.length();) {
+        std::size_t fend = record.find(field, fpos);
+        if (fend == std::string_view::npos)
+          fend = record.length();
+        if (fend > fpos)
+          f(record.substr(fpos, fend - fpos));
+        fpos = fend + field.length();
+      }
+      lpos = lend + line.length();
+    }
+  }
+
+  /**
+   * @brief Sorted
+   *
+   * Orders entries by descending count, breaking ties by token
+   */
+  void sorted(std::vector<TokenCounter::Entry>& entries) {
+    std::sort(entries.begin(), entries.end(),
+      [](const TokenCounter::Entry& a, const TokenCounter::Entry& b) {
+        return a.count != b.count ? a.count > b.count : a.token < b.token;
+      });
+  }
+}
+
+/**
+ * @brief TokenCounter
+ *
+ * Prepares a parallel frequency count of the fields of each line of a buffer
+ *
+ * @param field   The delimiter separating fields within a line
+ * @param line    The delimiter separating lines
+ * @param threads Number of worker threads, or zero for one per core
+ *
+ * @throws `std::invalid_argument` when either delimiter is empty
+ */
+TokenCounter::TokenCounter(const std::string& field, const std::string& line,
+    std::size_t threads): field{field}, line{line}, threads{threads} {
+  if (this->field.length() == 0 || this->line.length() == 0)
+    throw std::invalid_argument{"The delimiters must not be empty."};
+  if (this->threads == 0)
+    this->threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Chunks
+ *
+ * Divides a buffer into one chunk per thread, each ending on a line delimiter
+ *
+ * @param buffer The buffer to divide
+ *
+ * @return std::vector of (possibly empty) chunks covering the whole buffer
+ */
+std::vector<std::string_view> TokenCounter::chunks(
+    std::string_view buffer) const {
+  std::vector<std::string_view> result;
+  std::size_t start = 0;
+  for (std::size_t i = 1; i <= this->threads; i++) {
+    std::size_t end = buffer.length();
+    if (i < this->threads) {
+      // Move the nominal boundary past the next line delimiter
+      std::size_t nominal = std::max(start, buffer.length() * i /
+        this->threads);
+      std::size_t found = buffer.find(this->line, nominal);
+      end = found == std::string_view::npos ? buffer.length() :
+        found + this->line.length();
+    }
+    result.push_back(buffer.substr(start, end - start));
+    start = end;
+  }
+  return result;
+}
+
+/**
+ * @brief Count
+ *
+ * Counts every distinct non-empty field in the buffer exactly. Each thread
+ * counts its own chunk into private tables, one per hash partition, then
+ * each thread merges the tables of one partition.
+ *
+ * @param buffer The buffer of lines to count
+ *
+ * @return std::vector of tokens (views into `buffer`) with their counts, in
+ * order of descending count
+ */
+std::vector<TokenCounter::Entry> TokenCounter::count(
+    std::string_view buffer) const {
+  std::vector<std::string_view>   parts = this->chunks(buffer);
+  const std::size_t               n = parts.size();
+  // Tables indexed by counting thread, then by partition
+  std::vector<std::vector<Table>> local(n,
+    std::vector<Table>(n, Table{1024 / n}));
+  std::vector<std::thread>        workers;
+
+  // Count each chunk, routing tokens by the high bits of their hash
+  for (std::size_t t = 0; t < n; t++)
+    workers.emplace_back([&, t]() {
+      tokenize(parts[t], this->line, this->field, [&](std::string_view v) {
+        std::uint64_t h = Utility::hash(v);
+        local[t][(h >> 32) % n].insert(v, h)++;
+      });
+    });
+  for (std::thread& worker : workers)
+    worker.join();
+  workers.clear();
+
+  // Merge each partition from the tables routed to it
+  std::vector<std::vector<Entry>> merged(n);
+  for (std::size_t p = 0; p < n; p++)
+    workers.emplace_back([&, p]() {
+      Table table;
+      for (const std::vector<Table>& tables : local)
+        tables[p].each([&](std::string_view v, std::uint64_t h,
+            std::uint64_t c) {
+          table.insert(v, h) += c;
+        });
+      merged[p].reserve(table.size());
+      table.each([&](std::string_view v, std::uint64_t, std::uint64_t c) {
+        merged[p].push_back(Entry{v, c});
+      });
+    });
+  for (std::thread& worker : workers)
+    worker.join();
+
+  std::vector<Entry> result;
+  for (const std::vector<Entry>& entries : merged)
+    result.insert(result.end(), entries.begin(), entries.end());
+  sorted(result);
+  return result;
+}
+
+/**
+ * @brief Top
+ *
+ * Estimates the `k` most frequent fields in the buffer using bounded memory.
+ * Each thread keeps a Space-Saving summary of `4k` counters for its chunk and
+ * the summaries are combined at the end.
+ *
+ * @remarks Counts are upper bounds; any token occurring more than
+ * `n / (4k)` times in a chunk of `n` tokens is guaranteed to be tracked.
+ *
+ * @param buffer The buffer of lines to count
+ * @param k      Number of heavy hitters to return
+ *
+ * @return std::vector of up to `k` tokens (views into `buffer`) with their
+ * estimated counts, in order of descending count
+ */
+std::vector<TokenCounter::Entry> TokenCounter::top(std::string_view buffer,
+    std::size_t k) const {
+  if (k == 0)
+    return {};
+  std::vector<std::string_view> parts = this->chunks(buffer);
+  std::vector<Summary>          local(parts.size(), Summary{k * 4});
+  std::vector<std::thread>      workers;
+
+  for (std::size_t t = 0; t < parts.size(); t++)
+    workers.emplace_back([&, t]() {
+      tokenize(parts[t], this->line, this->field, [&](std::string_view v) {
+        local[t].add(v, Utility::hash(v));
+      });
+    });
+  for (std::thread& worker : workers)
+    worker.join();
+
+  // Sum the counters of all summaries, charging each token the minimum
+  // counter of every summary that does not track it, and keep the largest
+  Table table;
+  std::uint64_t floor = 0;
+  for (const Summary& summary : local) {
+    const std::uint64_t minimum = summary.minimum();
+    floor += minimum;
+    summary.each([&](std::string_view v, std::uint64_t h, std::uint64_t n) {
+      table.insert(v, h) += n - minimum;
+    });
+  }
+  std::vector<Entry> result;
+  table.each([&](std::string_view v, std::uint64_t, std::uint64_t n) {
+    result.push_back(Entry{v, n + floor});
+  });
+  sorted(result);
+  if (result.size() > k)
+    result.resize(k);
+  return result;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file  TokenCounter.hpp
+ * @brief TokenCounter
+ *
+ * Class definition for TokenCounter
+ *
+ * @author     Clay Freeman
+ * @date       October 18, 2026
+ */
+
+#ifndef _TOKENCOUNTER_HPP
+#define _TOKENCOUNTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TokenCounter {
+  public:
+    struct Entry {
+      std::string_view token;
+      std::uint64_t    count;
+    };
+  private:
+    std::string field;
+    std::string line;
+    std::size_t threads;
+    std::vector<std::string_view> chunks(std::string_view buffer) const;
+  public:
+    TokenCounter(const std::string& field, const std::string& line = "\n",
+      std::size_t threads = 0);
+    std::vector<Entry> count(std::string_view buffer) const;
+    std::vector<Entry> top(std::string_view buffer, std::size_t k) const;
+};
+
+#endif
@@ -9,19 +9,64 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <arpa/inet.h>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <utility>
 #include <vector>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+#include "Arena.hpp"
 #include "Utility.hpp"
 
+/**
+ * @brief Dedupe
+ *
+ * Removes duplicate views from a std::vector of std::string_view using a hash
+ * table, keeping the first occurrence of each value in its original order
+ *
+ * @param[out] v The std::vector of std::string_view to deduplicate
+ */
+void Utility::dedupe(std::vector<std::string_view>& v) {
+  // Size an open addressing table of indices to at most half occupancy
+  std::size_t capacity = 16;
+  while (capacity < v.size() * 2)
+    capacity <<= 1;
+  const std::size_t mask = capacity - 1, empty = SIZE_MAX;
+  std::vector<std::size_t>   slots(capacity, empty);
+  std::vector<std::uint64_t> hashes(capacity);
+  std::size_t out = 0;
+
+  for (std::size_t i = 0; i < v.size(); i++) {
+    const std::uint64_t h = Utility::hash(v[i]);
+    std::size_t slot = h & mask;
+    // Probe linearly until the value or an empty slot is found
+    while (slots[slot] != empty &&
+        (hashes[slot] != h || v[slots[slot]] != v[i]))
+      slot = (slot + 1) & mask;
+    if (slots[slot] != empty)
+      continue;
+    // Keep the first occurrence, compacting the vector in place
+    v[out]       = v[i];
+    slots[slot]  = out++;
+    hashes[slot] = h;
+  }
+  v.resize(out);
+}
+
 /**
  * @brief Explode
  *
@@ -47,6 +92,135 @@ std::vector<std::string> Utility::explode(const std::string& s,
   return result;
 }
 
+/**
+ * @brief Explode (View)
+ *
+ * Explodes a std::string_view by a delimiter to a std::vector of
+ * std::string_view referring to the original input, without copying
+ *
+ * @param s The std::string_view to explode
+ * @param d The delimiter to explode the std::string_view
+ *
+ * @return std::vector of std::string_view
+ */
+std::vector<std::string_view> Utility::explode_view(std::string_view s,
+    std::string_view d) {
+  std::size_t lpos = 0;
+  std::vector<std::string_view> result;
+
+  for (std::size_t cpos = 0; (cpos = s.find(d, lpos)) !=
+      std::string_view::npos; lpos = cpos + d.length())
+    // Add each item separated by a delimiter
+    result.push_back(s.substr(lpos, cpos - lpos));
+  // Add the last substr with no delimiter
+  result.push_back(s.substr(lpos));
+
+  return result;
+}
+
+/**
+ * @brief Fill
+ *
+ * Writes `n` bytes of a (possibly multi-byte) padding pattern, repeated and
+ * truncated as needed, directly into preallocated storage
+ *
+ * @param[out] out Destination for the padding
+ * @param      n   Number of bytes to write
+ * @param      pad The padding pattern
+ */
+static void fill(char* out, std::size_t n, std::string_view pad) {
+  if (n == 0 || pad.length() == 0)
+    return;
+  if (pad.length() == 1) {
+    memset(out, pad[0], n);
+    return;
+  }
+  // Seed one copy of the pattern, then double the written region
+  std::size_t done = std::min(n, pad.length());
+  memcpy(out, pad.data(), done);
+  for (; done < n; done *= 2)
+    memcpy(out + done, out, std::min(done, n - done));
+}
+
+/**
+ * @brief Format Row
+ *
+ * Formats cells into fixed-width columns with a single allocation, padding
+ * each cell according to its column and truncating cells that are too wide
+ *
+ * @param cells     The cells of the row
+ * @param columns   Width, alignment and fill character of each column
+ * @param separator The std::string_view placed between columns
+ *
+ * @remarks Cells without a matching column are ignored; missing cells are
+ * rendered as empty.
+ *
+ * @return The formatted row
+ */
+std::string Utility::format_row(const std::vector<std::string_view>& cells,
+    const std::vector<Column>& columns, std::string_view separator) {
+  // Size the whole row up front
+  std::size_t total = columns.size() > 0 ?
+    separator.length() * (columns.size() - 1) : 0;
+  for (const Column& column : columns)
+    total += column.width;
+  std::string result(total, '\0');
+
+  char* out = result.data();
+  for (std::size_t i = 0; i < columns.size(); i++) {
+    const Column& column = columns[i];
+    std::string_view cell = i < cells.size() ?
+      cells[i].substr(0, column.width) : std::string_view{};
+    std::size_t padding = column.width - cell.length();
+    std::size_t left = column.align == Align::Right ? padding :
+      column.align == Align::Center ? padding / 2 : 0;
+    memset(out, column.fill, left);
+    memcpy(out + left, cell.data(), cell.length());
+    memset(out + left + cell.length(), column.fill, padding - left);
+    out += column.width;
+    if (i + 1 < columns.size())
+      memcpy(out, separator.data(), separator.length()),
+      out += separator.length();
+  }
+  return result;
+}
+
+/**
+ * @brief Hash
+ *
+ * Computes a fast, well mixed 64-bit hash of a std::string_view, suitable for
+ * hash tables and cardinality sketches (but not for cryptographic use)
+ *
+ * @param s The std::string_view to hash
+ *
+ * @return 64-bit hash value
+ */
+std::uint64_t Utility::hash(std::string_view s) {
+  const std::uint64_t k = 0x9e3779b97f4a7c15ULL;
+  std::uint64_t h = 0x243f6a8885a308d3ULL ^ (s.length() * k);
+  const char*   p = s.data();
+  std::size_t   n = s.length();
+
+  // Absorb eight bytes at a time
+  for (; n >= 8; p += 8, n -= 8) {
+    std::uint64_t w;
+    memcpy(&w, p, 8);
+    h  = (h ^ w) * k;
+    h ^= h >> 32;
+  }
+  if (n > 0) {
+    // Absorb the remaining bytes zero padded
+    std::uint64_t w = 0;
+    memcpy(&w, p, n);
+    h  = (h ^ w) * k;
+    h ^= h >> 32;
+  }
+  // Finalize so that every input bit affects every output bit
+  h ^= h >> 30, h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27, h *= 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
 /**
  * @brief Implode
  *
@@ -83,6 +257,85 @@ std::string& Utility::ltrim(std::string& s) {
   return s;
 }
 
+/**
+ * @brief Pad
+ *
+ * Pads a std::string_view with a repeated pattern using a single allocation
+ *
+ * @param s       The std::string_view to pad
+ * @param pattern The padding pattern
+ * @param left    Number of bytes of padding placed before `s`
+ * @param right   Number of bytes of padding placed after `s`
+ *
+ * @return The padded std::string
+ */
+static std::string pad(std::string_view s, std::string_view pattern,
+    std::size_t left, std::size_t right) {
+  std::string result(s.length() + left + right, '\0');
+  fill(result.data(), left, pattern);
+  memcpy(result.data() + left, s.data(), s.length());
+  fill(result.data() + left + s.length(), right, pattern);
+  return result;
+}
+
+/**
+ * @brief Pad Both
+ *
+ * Pads both sides of a std::string_view to the given width, as with PHP's
+ * `str_pad(..., STR_PAD_BOTH)`; the right side receives any odd byte
+ *
+ * @param s     The std::string_view to pad
+ * @param width The minimum width of the result
+ * @param p     The padding pattern, repeated and truncated as needed
+ *
+ * @return The padded std::string (unchanged if already at least `width` long
+ * or if the pattern is empty)
+ */
+std::string Utility::pad_both(std::string_view s, std::size_t width,
+    std::string_view p) {
+  std::size_t n = s.length() < width && p.length() > 0 ?
+    width - s.length() : 0;
+  return pad(s, p, n / 2, n - n / 2);
+}
+
+/**
+ * @brief Pad Left
+ *
+ * Pads the left side of a std::string_view to the given width
+ *
+ * @param s     The std::string_view to pad
+ * @param width The minimum width of the result
+ * @param p     The padding pattern, repeated and truncated as needed
+ *
+ * @return The padded std::string (unchanged if already at least `width` long
+ * or if the pattern is empty)
+ */
+std::string Utility::pad_left(std::string_view s, std::size_t width,
+    std::string_view p) {
+  std::size_t n = s.length() < width && p.length() > 0 ?
+    width - s.length() : 0;
+  return pad(s, p, n, 0);
+}
+
+/**
+ * @brief Pad Right
+ *
+ * Pads the right side of a std::string_view to the given width
+ *
+ * @param s     The std::string_view to pad
+ * @param width The minimum width of the result
+ * @param p     The padding pattern, repeated and truncated as needed
+ *
+ * @return The padded std::string (unchanged if already at least `width` long
+ * or if the pattern is empty)
+ */
+std::string Utility::pad_right(std::string_view s, std::size_t width,
+    std::string_view p) {
+  std::size_t n = s.length() < width && p.length() > 0 ?
+    width - s.length() : 0;
+  return pad(s, p, 0, n);
+}
+
 /**
  * @brief Parse Address
  *
@@ -131,9 +384,8 @@ struct sockaddr_storage Utility::parse_addr(const std::string& addr) {
  * @return The resulting std::string
  */
 std::string Utility::repeat(const std::string& s, int n) {
-  std::string result;
-  for (int i = 0; i < n; i++)
-    result += s;
+  std::string result(n > 0 ? s.length() * n : 0, '\0');
+  fill(result.data(), result.length(), s);
   return result;
 }
 
@@ -183,6 +435,89 @@ std::string& Utility::rtrim(std::string& s) {
   return s;
 }
 
+/**
+ * @brief Radix Sort
+ *
+ * Sorts a range of std::string_view sharing a common prefix of `depth` bytes
+ * by most significant byte first radix sort, optionally collapsing equal
+ * values
+ *
+ * @param a      The range to sort
+ * @param t      Scratch space of the same length as `a`
+ * @param k      Scratch space for one key per element
+ * @param n      Number of elements in the range
+ * @param depth  Length of the common prefix already sorted on
+ * @param unique Whether to keep only one of each value
+ *
+ * @return The number of elements remaining at the start of `a`
+ */
+static std::size_t radix_sort(std::string_view* a, std::string_view* t,
+    std::uint16_t* k, std::size_t n, std::size_t depth, bool unique) {
+  for (;;) {
+    if (n < 32) {
+      // Small ranges are cheaper to insertion sort past the common prefix
+      for (std::size_t i = 1; i < n; i++) {
+        std::string_view x = a[i];
+        std::size_t j = i;
+        for (; j > 0 && a[j - 1].substr(depth) > x.substr(depth); j--)
+          a[j] = a[j - 1];
+        a[j] = x;
+      }
+      return unique ?
+        static_cast<std::size_t>(std::unique(a, a + n) - a) : n;
+    }
+
+    // Count the next byte of each element, with zero marking its end
+    std::size_t count[257] = {};
+    for (std::size_t i = 0; i < n; i++)
+      count[k[i] = a[i].length() > depth ?
+        static_cast<unsigned char>(a[i][depth]) + 1 : 0]++;
+    // Descend without moving anything while all elements share the byte
+    if (k[0] != 0 && count[k[0]] == n) {
+      depth++;
+      continue;
+    }
+
+    // Distribute the elements into their buckets
+    std::size_t offset[257];
+    for (std::size_t b = 0, sum = 0; b < 257; sum += count[b++])
+      offset[b] = sum;
+    for (std::size_t i = 0; i < n; i++)
+      t[offset[k[i]]++] = a[i];
+    std::copy(t, t + n, a);
+
+    // Sort each bucket on the following byte, compacting if unique
+    std::size_t out = 0, start = 0;
+    for (std::size_t b = 0; b < 257; start += count[b++]) {
+      if (count[b] == 0)
+        continue;
+      // Elements ending here are all equal to the common prefix
+      std::size_t m = b == 0 ? (unique ? 1 : count[b]) :
+        radix_sort(a + start, t + start, k + start, count[b], depth + 1,
+          unique);
+      if (out != start)
+        std::move(a + start, a + start + m, a + out);
+      out += m;
+    }
+    return out;
+  }
+}
+
+/**
+ * @brief Sort
+ *
+ * Sorts a std::vector of std::string_view in byte-wise order using a radix
+ * sort, which avoids the repeated pointer chasing of comparison sorts
+ *
+ * @param[out] v      The std::vector of std::string_view to sort
+ * @param      unique Whether to also remove duplicate values
+ */
+void Utility::sort(std::vector<std::string_view>& v, bool unique) {
+  std::vector<std::string_view> t(v.size());
+  std::vector<std::uint16_t>    k(v.size());
+  v.resize(radix_sort(v.data(), t.data(), k.data(), v.size(), 0, unique));
+}
+
 /**
  * @brief String to Lower
  *
@@ -197,6 +532,324 @@ std::string Utility::strtolower(std::string s) {
   return s;
 }
 
+/**
+ * @brief Shell Special
+ *
+ * Determines whether a byte is whitespace or has special meaning to the
+ * shell-like tokenizer
+ *
+ * @param c The byte to classify
+ *
+ * @return `true` for whitespace, quotes and backslashes
+ */
+static inline bool shell_special(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\'' ||
+    c == '"' || c == '\\';
+}
+
+/**
+ * @brief Find Shell Special
+ *
+ * Finds the next whitespace, quote or backslash, comparing sixteen bytes at a
+ * time where SSE2 is available
+ *
+ * @param s The std::string_view to search
+ * @param i Offset at which to begin searching
+ *
+ * @return Offset of the special byte, or the length of `s` if there is none
+ */
+static std::size_t find_shell_special(std::string_view s, std::size_t i) {
+#ifdef __SSE2__
+  const __m128i space = _mm_set1_epi8(' '),  tab    = _mm_set1_epi8('\t'),
+                lf    = _mm_set1_epi8('\n'), cr     = _mm_set1_epi8('\r'),
+                quote = _mm_set1_epi8('\''), dquote = _mm_set1_epi8('"'),
+                slash = _mm_set1_epi8('\\');
+  for (; i + 16 <= s.length(); i += 16) {
+    __m128i v = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(s.data() + i));
+    __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space),
+        _mm_cmpeq_epi8(v, tab)), _mm_or_si128(_mm_cmpeq_epi8(v, lf),
+        _mm_cmpeq_epi8(v, cr))), _mm_or_si128(_mm_or_si128(
+        _mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, dquote)),
+        _mm_cmpeq_epi8(v, slash)));
+    if (int bits = _mm_movemask_epi8(m))
+      return i + __builtin_ctz(static_cast<unsigned>(bits));
+  }
+#endif
+  while (i < s.length() && !shell_special(s[i]))
+    i++;
+  return i;
+}
+
+/**
+ * @brief Tokenize
+ *
+ * Splits a command line into words using shell-like rules: whitespace
+ * separates words, single quotes preserve everything literally, double quotes
+ * allow backslash escapes of `"`, `\`, `$`, `` ` `` and newlines, and a
+ * backslash elsewhere escapes the following byte
+ *
+ * @remarks Plain words and words that are quoted in their entirety without
+ * escapes are returned as views into `s`. Only words that need unescaping or
+ * joining are built, and those are stored in `arena`.
+ *
+ * @param      s     The command line to tokenize
+ * @param[out] arena Storage for unescaped words
+ *
+ * @throws `std::runtime_error` on an unterminated quote
+ *
+ * @return std::vector of std::string_view, one per word
+ */
+std::vector<std::string_view> Utility::tokenize(std::string_view s,
+    Arena& arena) {
+  auto space = [](char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  };
+  std::vector<std::string_view> result;
+  std::string scratch;
+
+  for (std::size_t i = 0;;) {
+    while (i < s.length() && space(s[i]))
+      i++;
+    if (i == s.length())
+      break;
+
+    // Plain words need no copy
+    std::size_t j = find_shell_special(s, i);
+    if (j > i && (j == s.length() || space(s[j]))) {
+      result.push_back(s.substr(i, j - i));
+      i = j;
+      continue;
+    }
+    // Neither do words quoted in their entirety without escapes
+    if (j == i && (s[i] == '\'' || s[i] == '"')) {
+      std::size_t q = s.find(s[i], i + 1);
+      bool plain = q != std::string_view::npos && (s[i] == '\'' ||
+        s.substr(i + 1, q - i - 1).find('\\') == std::string_view::npos);
+      if (plain && (q + 1 == s.length() || space(s[q + 1]))) {
+        result.push_back(s.substr(i + 1, q - i - 1));
+        i = q + 1;
+        continue;
+      }
+    }
+
+    // Build the unescaped word in reusable scratch space
+    scratch.clear();
+    bool quoted = false;
+    while (i < s.length() && !space(s[i])) {
+      if (s[i] == '\'') {
+        std::size_t q = s.find('\'', i + 1);
+        if (q == std::string_view::npos)
+          throw std::runtime_error{"Unterminated single quote."};
+        scratch.append(s.substr(i + 1, q - i - 1));
+        i = q + 1, quoted = true;
+      } else if (s[i] == '"') {
+        for (i++;; ) {
+          std::size_t k = s.find_first_of("\"\\", i);
+          if (k == std::string_view::npos)
+            throw std::runtime_error{"Unterminated double quote."};
+          scratch.append(s.substr(i, k - i));
+          if (s[k] == '"') {
+            i = k + 1;
+            break;
+          }
+          // Only some bytes may be escaped within double quotes
+          if (k + 1 < s.length() && std::string_view{"\"\\$`\n"}.find(
+              s[k + 1]) != std::string_view::npos) {
+            if (s[k + 1] != '\n')
+              scratch.push_back(s[k + 1]);
+            i = k + 2;
+          } else
+            scratch.push_back('\\'), i = k + 1;
+        }
+        quoted = true;
+      } else if (s[i] == '\\') {
+        // An escaped newline continues the line; a trailing `\` is literal
+        if (i + 1 == s.length())
+          scratch.push_back('\\'), i++;
+        else {
+          if (s[i + 1] != '\n')
+            scratch.push_back(s[i + 1]), quoted = true;
+          i += 2;
+        }
+      } else {
+        std::size_t k = find_shell_special(s, i);
+        scratch.append(s.substr(i, k - i));
+        i = k;
+      }
+    }
+    if (scratch.length() > 0 || quoted)
+      result.push_back(arena.store(scratch));
+  }
+  return result;
+}
+
+/**
+ * @brief Translate
+ *
+ * Maps every byte of a std::string in place through a compiled Translation
+ *
+ * @param s The string to transform
+ * @param t The Translation, as returned by `translation`
+ *
+ * @return The transformed std::string
+ */
+std::string& Utility::translate(std::string& s, const Translation& t) {
+  Utility::translate(s, &s[0], t);
+  return s;
+}
+
+/**
+ * @brief Translate
+ *
+ * Maps every byte of a std::string_view through a compiled Translation into
+ * a buffer, picking the fastest kernel the mapping allows: a compare and add
+ * when the remapped bytes form one shifted run (SSE2), a nibble-indexed
+ * shuffle when they fall within a few 16-byte rows (SSSE3), or a table
+ * lookup
+ *
+ * @param      s   The bytes to transform
+ * @param[out] out Storage for `s.length()` bytes (may be `s.data()` itself)
+ * @param      t   The Translation, as returned by `translation`
+ */
+void Utility::translate(std::string_view s, char* out,
+    const Translation& t) {
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(s.data());
+  unsigned char*       to = reinterpret_cast<unsigned char*>(out);
+  const std::size_t    n  = s.length();
+  std::size_t          i  = 0;
+  if (t.rows == 0) {
+    if (to != in)
+      memmove(to, in, n);
+    return;
+  }
+#ifdef __SSE2__
+  if (t.range) {
+    // Bytes in [first, last] are those with `x - first <= last - first`
+    const __m128i first = _mm_set1_epi8(static_cast<char>(t.first));
+    const __m128i span  = _mm_set1_epi8(static_cast<char>(t.last - t.first));
+    const __m128i delta = _mm_set1_epi8(static_cast<char>(t.delta));
+    for (; i + 16 <= n; i += 16) {
+      const __m128i x = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(in + i));
+      const __m128i d = _mm_sub_epi8(x, first);
+      const __m128i m = _mm_cmpeq_epi8(_mm_min_epu8(d, span), d);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i),
+        _mm_add_epi8(x, _mm_and_si128(m, delta)));
+    }
+  }
+#endif
+#ifdef __SSSE3__
+  // Row `h` of the map is a 16-byte shuffle table indexed by low nibble, and
+  // only rows containing remapped bytes need a lookup and blend; beyond a few
+  // such rows the table lookup below is faster
+  if (!t.range && __builtin_popcount(t.rows) <= 3) {
+    __m128i tables[16], keys[16];
+    int count = 0;
+    for (int h = 0; h < 16; h++)
+      if (t.rows >> h & 1) {
+        tables[count] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(t.map.data() + h * 16));
+        keys[count++] = _mm_set1_epi8(static_cast<char>(h));
+      }
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    for (; i + 16 <= n; i += 16) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+      const __m128i lo = _mm_and_si128(x, nibble);
+      const __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+      for (int k = 0; k < count; k++) {
+        const __m128i m = _mm_cmpeq_epi8(hi, keys[k]);
+        x = _mm_or_si128(_mm_andnot_si128(m, x),
+          _mm_and_si128(m, _mm_shuffle_epi8(tables[k], lo)));
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i), x);
+    }
+  }
+#endif
+  for (; i < n; i++)
+    to[i] = t.map[in[i]];
+}
+
+/**
+ * @brief Translation
+ *
+ * Compiles an arbitrary 256-entry byte map for `translate`, recording which
+ * rows of the map are not the identity and whether the remapped bytes form a
+ * single run shifted by a constant (as for case conversion)
+ *
+ * @param map The destination byte for every source byte
+ *
+ * @return The compiled Translation
+ */
+Utility::Translation Utility::translation(
+    const std::array<unsigned char, 256>& map) {
+  Translation result;
+  result.map = map;
+  int first = -1, last = -1;
+  bool shifted = true;
+  for (int c = 0; c < 256; c++) {
+    if (map[c] == c)
+      continue;
+    result.rows |= static_cast<std::uint16_t>(1u << (c >> 4));
+    const unsigned char delta = static_cast<unsigned char>(map[c] - c);
+    if (first < 0)
+      first = c, result.delta = delta;
+    else if (last != c - 1 || delta != result.delta)
+      shifted = false;
+    last = c;
+  }
+  if (first >= 0 && shifted) {
+    result.range = true;
+    result.first = static_cast<unsigned char>(first);
+    result.last  = static_cast<unsigned char>(last);
+  }
+  return result;
+}
+
+/**
+ * @brief Translation
+ *
+ * Compiles a byte map in the style of tr(1): each byte of `from` maps to the
+ * byte at the same position of `to`, whose last byte is repeated if it is the
+ * shorter; "a-z" style ranges are expanded in both
+ *
+ * @param from The bytes to replace
+ * @param to   Their replacements
+ *
+ * @throws `std::invalid_argument` when `to` is empty but `from` is not
+ *
+ * @return The compiled Translation
+ */
+Utility::Translation Utility::translation(std::string_view from,
+    std::string_view to) {
+  auto expand = [](std::string_view s) {
+    std::string result;
+    for (std::size_t i = 0; i < s.length(); i++) {
+      const unsigned char a = static_cast<unsigned char>(s[i]);
+      if (i + 2 < s.length() && s[i + 1] == '-' &&
+          a <= static_cast<unsigned char>(s[i + 2])) {
+        for (unsigned c = a; c <= static_cast<unsigned char>(s[i + 2]); c++)
+          result.push_back(static_cast<char>(c));
+        i += 2;
+      } else {
+        result.push_back(s[i]);
+      }
+    }
+    return result;
+  };
+  const std::string source = expand(from), target = expand(to);
+  if (target.empty() && !source.empty())
+    throw std::invalid_argument{"The replacement set must not be empty."};
+  std::array<unsigned char, 256> map;
+  for (unsigned c = 0; c < 256; c++)
+    map[c] = static_cast<unsigned char>(c);
+  for (std::size_t i = 0; i < source.length(); i++)
+    map[static_cast<unsigned char>(source[i])] = static_cast<unsigned char>(
+      target[std::min(i, target.length() - 1)]);
+  return Utility::translation(map);
+}
+
 /**
  * @brief Trim
  *
@@ -209,3 +862,114 @@ std::string Utility::strtolower(std::string s) {
 std::string& Utility::trim(std::string& s) {
   return Utility::ltrim(Utility::rtrim(s));
 }
+
+/**
+ * @brief Wrap
+ *
+ * Scans a std::string_view once for break opportunities, invoking a callback
+ * with a view of each wrapped line (without any break string)
+ *
+ * @param s     The std::string_view to wrap
+ * @param width The maximum line width
+ * @param brk   The line break already separating lines in `s`
+ * @param cut   Whether words longer than `width` are cut
+ * @param emit  Callback invoked with each line
+ *
+ * @throws `std::invalid_argument` when the break string is empty
+ */
+template <typename F>
+static void wrap(std::string_view s, std::size_t width, std::string_view brk,
+    bool cut, F emit) {
+  if (brk.length() == 0)
+    throw std::invalid_argument{"The break string must not be empty."};
+
+  // As in PHP, `space` is the last space seen and only counts as a break
+  // opportunity while it lies beyond the start of the current line. PHP's
+  // separate path for a single byte break without cutting also honors a
+  // break in the final byte, which its general path ignores.
+  const bool last = brk.length() == 1 && !cut;
+  std::size_t start = 0, space = 0;
+  for (std::size_t i = 0; i < s.length(); i++) {
+    if (s[i] == brk[0] && (last || i + brk.length() < s.length()) &&
+        s.compare(i, brk.length(), brk) == 0) {
+      // Existing line breaks always end the current line
+      emit(s.substr(start, i - start));
+      i += brk.length() - 1;
+      start = space = i + 1;
+    } else if (s[i] == ' ') {
+      // Break at a space once the line is full, and remember it either way
+      if (i - start >= width)
+        emit(s.substr(start, i - start)), start = i + 1;
+      space = i;
+    } else if (i - start >= width && cut && start >= space && i > start) {
+      // There is no space to break at, so cut the word here
+      emit(s.substr(start, i - start)), start = space = i;
+    } else if (i - start >= width && start < space) {
+      // This byte would overflow the line; break at the last space
+      emit(s.substr(start, space - start)), start = space = space + 1;
+    }
+  }
+  // A break string ending the input is copied as is, ending the last line
+  std::string_view rest = s.substr(start);
+  if (rest.length() >= brk.length() &&
+      rest.compare(rest.length() - brk.length(), brk.length(), brk) == 0) {
+    emit(rest.substr(0, rest.length() - brk.length()));
+    emit(std::string_view{});
+  } else {
+    emit(rest);
+  }
+}
+
+/**
+ * @brief Word Wrap
+ *
+ * Wraps a std::string_view to the given width, as with PHP's `wordwrap`,
+ * writing the result with a single allocation and without copying words
+ *
+ * @param s     The std::string_view to wrap
+ * @param width The maximum line width
+ * @param brk   The line break to insert (and to recognize in `s`)
+ * @param cut   Whether words longer than `width` are cut
+ *
+ * @throws `std::invalid_argument` when the break string is empty
+ *
+ * @return The wrapped std::string
+ */
+std::string Utility::wordwrap(std::string_view s, std::size_t width,
+    std::string_view brk, bool cut) {
+  std::string result;
+  result.reserve(s.length() +
+    (s.length() / std::max<std::size_t>(width, 1) + 1) * brk.length());
+  bool first = true;
+  wrap(s, width, brk, cut, [&](std::string_view line) {
+    if (!first)
+      result.append(brk);
+    result.append(line);
+    first = false;
+  });
+  return result;
+}
+
+/**
+ * @brief Wrap Lines
+ *
+ * Wraps a std::string_view to the given width, returning views of each line
+ * rather than building a new std::string
+ *
+ * @param s     The std::string_view to wrap
+ * @param width The maximum line width
+ * @param brk   The line break already separating lines in `s`
+ * @param cut   Whether words longer than `width` are cut
+ *
+ * @throws `std::invalid_argument` when the break string is empty
+ *
+ * @return std::vector of std::string_view, one per line
+ */
+std::vector<std::string_view> Utility::wrap_lines(std::string_view s,
+    std::size_t width, std::string_view brk, bool cut) {
+  std::vector<std::string_view> result;
+  wrap(s, width, brk, cut, [&result](std::string_view line) {
+    result.push_back(line);
+  });
+  return result;
+}
@@ -11,28 +11,75 @@
 #ifndef _UTILITY_HPP
 #define _UTILITY_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <netinet/in.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
+class Arena;
+
 class Utility {
   private:
     // Prevent this class from being instantiated
     Utility() {}
   public:
+    enum class Align { Left, Right, Center };
+    struct Column {
+      std::size_t width;
+      Align       align = Align::Left;
+      char        fill  = ' ';
+    };
+    // A compiled byte-to-byte mapping for `translate`
+    struct Translation {
+      std::array<unsigned char, 256> map{};
+      // Set when the remapped bytes form one run shifted by `delta`
+      bool          range = false;
+      unsigned char first = 0;
+      unsigned char last  = 0;
+      unsigned char delta = 0;
+      // Bit `h` is set when a byte with high nibble `h` is remapped
+      std::uint16_t rows  = 0;
+    };
+    static void dedupe(std::vector<std::string_view>& v);
     static std::vector<std::string> explode(const std::string& s,
       const std::string& d);
+    static std::vector<std::string_view> explode_view(std::string_view s,
+      std::string_view d);
+    static std::string  format_row(const std::vector<std::string_view>& cells,
+      const std::vector<Column>& columns, std::string_view separator = " ");
+    static std::uint64_t hash(std::string_view s);
     static std::string  implode(const std::vector<std::string>& v,
       const std::string& d);
     static std::string& ltrim(std::string& s);
+    static std::string  pad_both(std::string_view s, std::size_t width,
+      std::string_view pad = " ");
+    static std::string  pad_left(std::string_view s, std::size_t width,
+      std::string_view pad = " ");
+    static std::string  pad_right(std::string_view s, std::size_t width,
+      std::string_view pad = " ");
     static struct sockaddr_storage parse_addr(const std::string& addr);
     static std::string  repeat(const std::string& s, int n);
     static std::string  replace(const std::string& search,
         const std::string& replace, const std::string& subject,
         const int limit = 0);
     static std::string& rtrim(std::string& s);
+    static void sort(std::vector<std::string_view>& v, bool unique = false);
     static std::string  strtolower(std::string s);
+    static std::vector<std::string_view> tokenize(std::string_view s,
+      Arena& arena);
+    static std::string& translate(std::string& s, const Translation& t);
+    static void translate(std::string_view s, char* out,
+      const Translation& t);
+    static Translation translation(const std::array<unsigned char, 256>& map);
+    static Translation translation(std::string_view from, std::string_view to);
     static std::string& trim(std::string& s);
+    static std::string  wordwrap(std::string_view s, std::size_t width = 75,
+      std::string_view brk = "\n", bool cut = false);
+    static std::vector<std::string_view> wrap_lines(std::string_view s,
+      std::size_t width = 75, std::string_view brk = "\n", bool cut = false);
 };
 
 #endif